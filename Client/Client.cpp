@@ -7,6 +7,7 @@
 #include <iostream>
 #include <arpa/inet.h>
 #include <climits>
+#include <signal.h>
 #include "Utilities.h"
 
 #pragma region Globals
@@ -37,6 +38,12 @@ int intBuf;
 */
 char username[Size::USERNAME];
 
+/*
+* Server's host name and session token for reconnecting
+*/
+const char* hostName;
+Token token{Session::NONE};
+
 #pragma endregion
 
 #pragma region TCP
@@ -85,10 +92,30 @@ void tcpConnection(const char* hostName) {
 	connect(&addr);
 }
 
+/*
+* Retry TCP connection with server, return true once connected
+*/
+bool tcpReconnection() {
+
+	sockaddr_in addr;
+	initialize(&addr, hostName);
+	tcpSocket();
+
+	for (int tries = 0; tries < Default::RECONNECT_TRIES; tries++) {
+		if (connect(sock, (sockaddr*)&addr, sizeof(addr)) == EXIT_SUCCESS) {
+			return true;
+		}
+		sleep(1);
+	}
+	return false;
+}
+
 #pragma endregion
 
 #pragma region Socket read/write
 
+void reconnect();
+
 /*
 * Return true if input was not a valid int
 */
@@ -116,9 +143,30 @@ void getInput() {
 */
 void readFromServer() {
 	bytes = readFrom(sock, inputBuf, Size::BUF);
+	if (bytes <= 0) {
+		reconnect();
+	}
 	printf("%.*s", bytes, inputBuf);
 }
 
+/*
+* Read a signal or int from server, reconnect if connection was lost
+*/
+bool readBool() {
+	bool buf;
+	if (!tryReadFrom(sock, &buf, sizeof(bool))) {
+		reconnect();
+	}
+	return buf;
+}
+int readInt() {
+	int buf;
+	if (!tryReadFrom(sock, &buf, sizeof(int))) {
+		reconnect();
+	}
+	return buf;
+}
+
 /*
 * Get user input from console and send throuh socket
 */
@@ -146,7 +194,7 @@ void promptUserName() {
 * Return true if server's response is bad username
 */
 bool userNameTaken() {
-	bool taken = readBoolFrom(sock);
+	bool taken = readBool();
 	if (taken) {
 		printf(Bad::NAME);
 	}
@@ -160,13 +208,22 @@ void saveUserName() {
 	strncpy(username, outputBuf.c_str(), outputBuf.size());
 }
 
+/*
+* Read the session token issued by server and display it
+* so the player can return to their seat from a new client
+*/
+void readToken() {
+	readFrom(sock, &token, sizeof(Token));
+	printf(Prompt::TOKEN, token);
+}
+
 /*
 * Register the new player:
 *	- read user name prompt froms server
 *	- write user name choice to server
 *	- read server's response
 *	- retry user name selection while user name taken
-*	-
+*	- read session token
 */
 void registerPlayer() {
 
@@ -176,6 +233,7 @@ void registerPlayer() {
 	}
 	while (userNameTaken());
 	saveUserName();
+	readToken();
 }
 
 #pragma endregion
@@ -193,7 +251,7 @@ void promptGame() {
 * Return true if string says game was joined
 */
 bool gameJoined() {
-	bool joined = readBoolFrom(sock);
+	bool joined = readBool();
 	if (!joined) {
 		printf(Bad::GAME);
 	}
@@ -207,9 +265,65 @@ void printJoined() {
 	printf(Prompt::JOINED);
 }
 
+/*
+* Print the game's event stream as a spectator until it ends
+*/
+void watch() {
+
+	printf(Prompt::WATCHING);
+	while ((bytes = readFrom(sock, inputBuf, Size::BUF)) > 0) {
+		printf("%.*s", bytes, inputBuf);
+		fflush(stdout);
+	}
+	exit(0);
+}
+
+/*
+* Send the ID of the game to watch,
+* watch it if the server attached the player as a spectator
+*/
+bool watchJoined() {
+
+	printf(Prompt::WATCH);
+	writeIntToServer();
+	if (gameJoined()) {
+		watch();
+	}
+	return false;
+}
+
+/*
+* Send the rules chosen for the new game
+*/
+bool createJoined() {
+
+	printf(Prompt::RULES);
+	writeIntToServer();
+	return gameJoined();
+}
+
+/*
+* Return true if the chosen game was joined, watched or created
+*/
+bool chosenJoined() {
+
+	switch (intBuf) {
+
+	case Default::WATCH_ID:
+		return watchJoined();
+
+	case Default::CREATE_ID:
+		return createJoined();
+
+	default:
+		return gameJoined();
+	}
+}
+
 /*
 * Read the list of games from the server and display to player,
-* send player's chosen game ID to server,
+* send player's chosen game ID to server, or watch a game,
+* or create one choosing its rules,
 * make player re-choose while chosen game is full or ending
 */
 void chooseGame() {
@@ -219,7 +333,7 @@ void chooseGame() {
 	do {
 		writeIntToServer();
 	}
-	while (!gameJoined());
+	while (!chosenJoined());
 	printJoined();
 }
 
@@ -231,7 +345,7 @@ void chooseGame() {
 * Wait for gameplay until server signals start
 */
 void waitForStart() {
-	readBoolFrom(sock);
+	readBool();
 }
 
 /*
@@ -272,7 +386,7 @@ void placeBet() {
 */
 ROUND_STATUS checkStatus() {
 
-	return (ROUND_STATUS) readFrom(sock);
+	return (ROUND_STATUS) readInt();
 }
 
 /*
@@ -304,7 +418,7 @@ void displayTurn() {
 * Return signal from server
 */
 bool nextTurn() {
-	return readBoolFrom(sock);
+	return readBool();
 }
 
 /*
@@ -318,7 +432,7 @@ bool myTurn() {
 * Return true is user's input is a valid action
 */
 bool validAction() {
-	bool valid = STAND <= intBuf && intBuf <= DOUBLE_DOWN;
+	bool valid = STAND <= intBuf && intBuf <= SPLIT;
 	if (!valid) {
 		printf(Bad::ACTION);
 	}
@@ -364,7 +478,7 @@ void displayStats() {
 * Server sends true if next round
 */
 bool nextRound() {
-	return readBoolFrom(sock);
+	return readBool();
 }
 
 /*
@@ -375,6 +489,37 @@ void gameOver() {
 	exit(0);
 }
 
+/*
+* Display the dealer's turn and the round's stats
+*/
+void finishRound() {
+	displayCards();
+	sleep(Default::DISPLAY_WAIT);
+	displayStats();
+}
+
+/*
+* Play out the round after bets are placed
+*/
+void playRound() {
+
+	switch (checkStatus()) {
+
+	case CONTINUE:
+		displayCards();
+		takeTurns();
+		finishRound();
+		break;
+
+	case ADD_PLAYER:
+		displayRoundSkipped();
+		break;
+
+	case OVER:
+		gameOver();
+	}
+}
+
 /*
 * Play rounds of game until over
 */
@@ -383,28 +528,78 @@ void play() {
 	do {
 		waitForStart();
 		placeBet();
+		playRound();
+	}
+	while (nextRound());
 
-		switch (checkStatus()) {
+	gameOver();
+}
 
-		case CONTINUE:
-			displayCards();
-			takeTurns();
-			displayCards();
-			sleep(Default::DISPLAY_WAIT);
-			displayStats();
-			break;
+/*
+* Rejoin the round at the phase the server resumed the session at,
+* then play the remaining rounds
+*/
+void resume(RESUME_PHASE phase) {
 
-		case ADD_PLAYER:
-			displayRoundSkipped();
-			break;
+	switch (phase) {
 
-		case OVER:
-			gameOver();
-		}
+	case BETTING:
+		placeBet();
+		playRound();
+		break;
+
+	case TURN:
+		startTurn();
+		displayCards();
+		sleep(Default::DISPLAY_WAIT);
+		takeTurns();
+		finishRound();
+		break;
+
+	case ROUND:
+		play();
 	}
-	while (nextRound());
 
-	gameOver();
+	if (!nextRound()) {
+		gameOver();
+	}
+	play();
+}
+
+#pragma endregion
+
+#pragma region Session
+
+/*
+* Send session token to server, resume the game as the seat's
+* username if server returned the player to their seat
+*/
+bool resumeSession() {
+
+	writeTo(sock, &token, sizeof(Token));
+	if (!readBoolFrom(sock)) {
+		return false;
+	}
+	if (!tryReadFrom(sock, username, Size::USERNAME)) {
+		gracefulExit(Bad::SESSION, sock);
+	}
+	printf(Prompt::RESUMED);
+	resume((RESUME_PHASE) readInt());
+	return true;
+}
+
+/*
+* Reconnect to server after the connection was lost and
+* resume the session, exit if the seat is no longer held
+*/
+void reconnect() {
+
+	printf(Prompt::RECONNECTING);
+	close(sock);
+
+	if (token == Session::NONE || !tcpReconnection() || !resumeSession()) {
+		gracefulExit(Bad::SESSION, sock);
+	}
 }
 
 #pragma endregion
@@ -414,14 +609,22 @@ void play() {
 */
 void checkArgCount(int argc) {
 
-	if (argc != Default::EXPECTED_ARGS) {
+	if (argc != Default::EXPECTED_ARGS && argc != Default::EXPECTED_ARGS + 1) {
 		gracefulExit(Bad::ARG);
 	}
 }
 
+/*
+* Return the session token given on the command line, if any
+*/
+Token argToken(int argc, char* argv[]) {
+	return argc > Default::EXPECTED_ARGS ? strtoull(argv[2], nullptr, 10) : Session::NONE;
+}
+
 /*
 * Check that server's address was given,
 * create a tcp connection with server,
+* resume a previous session if a token was given, otherwise
 * register with a username,
 * choose a game to join or create one,
 * play the game
@@ -429,7 +632,16 @@ void checkArgCount(int argc) {
 int main(int argc, char* argv[]) {
 
 	checkArgCount(argc);
-	tcpConnection(argv[1]);
+	signal(SIGPIPE, SIG_IGN);
+	hostName = argv[1];
+	token = argToken(argc, argv);
+	tcpConnection(hostName);
+	if (resumeSession()) {
+		return 0;
+	}
+	if (token != Session::NONE) {
+		printf(Bad::SESSION);
+	}
 	registerPlayer();
 	chooseGame();
 	play();
@@ -112,6 +112,25 @@ bool readBoolFrom(int sock) {
 	return buf;
 }
 
+/*
+* Read exactly sz bytes from socket, return false if connection was lost
+*/
+bool tryReadFrom(int sock, void* buf, int sz) {
+
+	int total{0}, bytes;
+	while (total < sz) {
+		bytes = read(sock, (char*) buf + total, sz - total);
+		if (bytes <= 0) {
+			if (bytes < 0) {
+				perror(Failure::READ);
+			}
+			return false;
+		}
+		total += bytes;
+	}
+	return true;
+}
+
 /*
 * Initialize, lock and unlock a mutex
 */
@@ -23,9 +23,10 @@
 */
 namespace Prompt {
 	constexpr auto NAME = "Please enter a username (no spaces): ",
-		GAME = "\n\nPlease enter a game ID from the follwing (-1 for new game)\n",
+		GAME = "\n\nPlease enter a game ID from the follwing (-1 for new game, -2 to watch a game)\n",
 		LIST1 = "\nGame ID: ",
 		LIST2 = "\nPlayers:",
+		LIST3 = "\nRules: ",
 		BET = "\n-------------------------------"
 		"\n\tPlace your bet!\n------------------------------\n\nTable Rules: "
 		"\n - Minimum Bet = $2\n - Maximum Bet = $10\n - Bet must be in $2 increments"
@@ -33,7 +34,7 @@ namespace Prompt {
 		TURN1 = "It's ",
 		TURN2 = "'s turn!\n",
 		TURN3 = "\n\nBelow are the options and their integer-only commands: "
-		"\n - Play Commands:\t\t[1] = Hit	|	[3] = Double Down"
+		"\n - Play Commands:\t\t[1] = Hit	|	[3] = Double Down	|	[4] = Split"
 		"\n - Non-Play Commands:\t\t[0] = Stand	|	[2] = Surrender\n",
 		NO_GAMES = "\nNo current games\n\n",
 		JOINED = "\nGame joined, please wait for game to start\n",
@@ -45,18 +46,27 @@ namespace Prompt {
 		HIT = "hit!",
 		SURRENDER = "surrender!",
 		DOUBLE_DOWN = "double down!",
-		STAND = "stand";
+		SPLIT = "split!",
+		STAND = "stand",
+		TOKEN = "\nSession token (pass as second argument to reconnect): %llu\n",
+		RECONNECTING = "\nConnection lost, reconnecting to server...\n",
+		RESUMED = "\nSession resumed, returning to your seat\n",
+		RULES = "\nPlease enter the new game's rules (0 = house, 1 = strip, 2 = downtown, 3 = sixfive, -1 for the server's): ",
+		WATCH = "\nPlease enter the game ID to watch: ",
+		WATCHING = "\nWatching game, press CTRL-C to leave\n\n";
 }
 
 /*
 * Responses that player input was bad
 */
 namespace Bad {
-	constexpr auto ARG = "usage: ./client serverAddress\n",
+	constexpr auto ARG = "usage: ./client serverAddress [sessionToken]\n",
+		SERVER_ARG = "usage: ./server [botsPerTable 0-3 [house|strip|downtown|sixfive]]\n",
 		NAME = "Sorry, this username is already taken, please try again: ",
 		GAME = "Invalid game ID, please try again: ",
 		BET = "Invalid bet amount, please try again: ",
 		ACTION = "Invalid action, please try again: ",
+		SESSION = "\nSession has expired, unable to return to your seat\n",
 		DOUBLE_DOWN = "\n!!Unable to Double Down -- Your balance is too low!!"
 		"\nPlease either Hit, Surrender, or Stand.\n";
 }
@@ -66,7 +76,8 @@ namespace Bad {
 */
 namespace Size {
 	constexpr auto USERNAME = 50,
-		BUF = 2000;
+		BUF = 2000,
+		RING = 1 << 16;
 }
 
 /*
@@ -75,9 +86,30 @@ namespace Size {
 namespace Default {
 	constexpr auto EXPECTED_ARGS = 2,
 		CREATE_ID = -1,
+		WATCH_ID = -2,
 		DISPLAY_WAIT = 3,
 		STARTER_WAIT = 5,
-		MAX_GAMES = 5;
+		MAX_GAMES = 5,
+		RECONNECT_GRACE = 30,
+		RECONNECT_TRIES = 10,
+		MAX_WATCHERS = 1024,
+		WATCH_RETRY_MS = 10;
+}
+
+/*
+* Session token values
+*/
+namespace Session {
+	constexpr auto NONE = 0ULL;
+}
+
+/*
+* Server-side bot players, named NAME followed by the game id,
+* a dash and a number
+*/
+namespace Bot {
+	constexpr auto NAME = "Bot";
+	constexpr auto MAX = 3;
 }
 
 /*
@@ -105,6 +137,7 @@ namespace Failure {
 		READ = "read() failure\n",
 		FORK = "fork() failure\n",
 		INIT = "pthread_mutex_init() failure\n",
+		COND = "pthread_cond_init() failure\n",
 		LOCK = "pthread_mutex_lock() failure\n",
 		UNLOCK = "pthread_mutex_unlock() failure\n",
 		TIME = "gettimeofday() failure\n";
@@ -127,7 +160,8 @@ enum ACTION {
 	STAND,
 	HIT,
 	SURRENDER,
-	DOUBLE_DOWN
+	DOUBLE_DOWN,
+	SPLIT
 };
 
 /*
@@ -139,12 +173,27 @@ enum ROUND_STATUS {
 	OVER
 };
 
+/*
+* Point in the round a reconnecting player is resumed at
+*/
+enum RESUME_PHASE {
+	ROUND,
+	BETTING,
+	TURN
+};
+
+/*
+* Session token issued at registration for reconnecting
+*/
+using Token = unsigned long long;
+
 /*
 * Variables for registering new player and adding to a game
 */
 struct NewPlayer {
-	explicit NewPlayer(int* fd) :sock{*fd} {}
+	explicit NewPlayer(int* fd) :sock{*fd}, token{Session::NONE} {}
 	int sock, gameId;
+	Token token;
 	char buf[Size::BUF];
 	std::string userName;
 };
@@ -189,6 +238,11 @@ int readFrom(int sock, void* buf, int sz);
 int readFrom(int sock);
 bool readBoolFrom(int sock);
 
+/*
+* Read exactly sz bytes from socket, return false if connection was lost
+*/
+bool tryReadFrom(int sock, void* buf, int sz);
+
 /*
 * Initialize, lock and unlock a mutex
 */
@@ -0,0 +1,275 @@
+/*
+* History.cpp
+*
+* CSS 432 Group Lucky No 13
+*
+* Queries the server's binary hand history log through its index,
+* or plays a table again from it
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <chrono>
+#include <string>
+#include "MappedFile.h"
+#include "HistoryIndex.h"
+#include "HistoryQuery.h"
+#include "Replay.h"
+
+#pragma region Options
+
+/*
+* Command line flags
+*/
+namespace Flag {
+	constexpr auto PLAYER = "--player",
+		TABLE = "--table",
+		FROM = "--from",
+		TO = "--to",
+		ACTION = "--action",
+		TOTAL = "--total",
+		UPCARD = "--upcard",
+		COUNT = "--count",
+		REINDEX = "--reindex",
+		REPLAY = "--replay";
+}
+
+/*
+* Output and usage
+*/
+namespace Report {
+	constexpr auto USAGE = "usage: ./history LOG [--player NAME] [--table ID] [--from SECONDS] [--to SECONDS] "
+		"[--action bet|hit|stand|split|double|surrender|sit|leave] [--total N] [--upcard A|2-10] [--count] [--reindex]\n"
+		"       ./history LOG --replay TABLE [--reindex]\n",
+		BAD_LOG = "Unable to read hand history: %s\n",
+		BAD_INDEX = "Unable to write index: %s\n",
+		BAD_ACTION = "Unknown action: %s\n",
+		INDEXED = "Indexed %llu rounds of %s (%.2fs)\n",
+		TIME = "%Y-%m-%d %H:%M:%S",
+		ROUND = "%s  Table %u  Round %u ",
+		PLAYER = " %.*s",
+		ACTION = " %.*s hand %d: ",
+		CARD = "%s ",
+		HAND = "%s%d vs %s, %s\n",
+		SOFT = "soft ",
+		HARD = "",
+		NO_UPCARD = "-",
+		SUMMARY = "%lld matches, %lld rounds read of %llu indexed (%.2fs)\n",
+		REPLAYED = "Replayed %lld rounds of table %lld, %lld events the same as logged (%.2fs, %.0f rounds/s)\n",
+		DIVERGED = "Replay of table %lld stopped after %lld rounds, at %s\n";
+}
+
+/*
+* Upcard names by rank
+*/
+const char* const UPCARDS[] = { "-", "A", "2", "3", "4", "5", "6", "7", "8", "9", "10" };
+
+/*
+* Options chosen on the command line
+*/
+struct Options {
+	std::string log;
+	Query query;
+	bool count{false};
+	bool reindex{false};
+	long long replay{ANY};
+};
+
+/*
+* Print usage and exit
+*/
+void usage() {
+	printf(Report::USAGE);
+	exit(EXIT_FAILURE);
+}
+
+/*
+* HistoryAction by name
+*/
+int getAction(const char* name) {
+
+	for (int i = 0; i < (int) (sizeof(HISTORY_ACTIONS) / sizeof(HISTORY_ACTIONS[0])); i++) {
+		if (strcmp(name, HISTORY_ACTIONS[i]) == 0) {
+			return i;
+		}
+	}
+	printf(Report::BAD_ACTION, name);
+	usage();
+	return ANY;
+}
+
+/*
+* Read the flags given on the command line
+*/
+Options parseOptions(int argc, char* argv[]) {
+
+	Options options;
+	if (argc < 2) {
+		usage();
+	}
+	options.log = argv[1];
+	for (int i = 2; i < argc; i++) {
+
+		if (strcmp(argv[i], Flag::COUNT) == 0) {
+			options.count = true;
+			continue;
+		}
+		if (strcmp(argv[i], Flag::REINDEX) == 0) {
+			options.reindex = true;
+			continue;
+		}
+		if (i + 1 >= argc) {
+			usage();
+		}
+		const char* value = argv[++i];
+
+		if (strcmp(argv[i - 1], Flag::PLAYER) == 0) {
+			options.query.player = value;
+		}
+		else if (strcmp(argv[i - 1], Flag::TABLE) == 0) {
+			options.query.table = atoll(value);
+		}
+		else if (strcmp(argv[i - 1], Flag::FROM) == 0) {
+			options.query.from = atoll(value) * 1000000LL;
+		}
+		else if (strcmp(argv[i - 1], Flag::TO) == 0) {
+			options.query.to = atoll(value) * 1000000LL + 999999;
+		}
+		else if (strcmp(argv[i - 1], Flag::ACTION) == 0) {
+			options.query.action = getAction(value);
+		}
+		else if (strcmp(argv[i - 1], Flag::TOTAL) == 0) {
+			options.query.total = atoi(value);
+		}
+		else if (strcmp(argv[i - 1], Flag::UPCARD) == 0) {
+			options.query.upcard = (toupper(value[0]) == 'A') ? ACE : atoi(value);
+		}
+		else if (strcmp(argv[i - 1], Flag::REPLAY) == 0) {
+			options.replay = atoll(value);
+		}
+		else {
+			usage();
+		}
+	}
+	return options;
+}
+
+#pragma endregion
+
+#pragma region Index
+
+/*
+* Open the log's index, building it first if there is none,
+* it covers less of the log than there is, or a rebuild was asked for
+*/
+void openIndex(const Options* options, const MappedFile* log, HistoryIndex* index) {
+
+	std::string path = options->log + INDEX_SUFFIX;
+	if (!options->reindex && index->open(path) && index->getLogSize() == log->size()) {
+		return;
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	if (!HistoryIndex::build(*log, path) || !index->open(path)) {
+		printf(Report::BAD_INDEX, path.c_str());
+		exit(EXIT_FAILURE);
+	}
+	std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+	fprintf(stderr, Report::INDEXED, (unsigned long long) index->getNumRecords(), options->log.c_str(), seconds.count());
+}
+
+#pragma endregion
+
+#pragma region Output
+
+/*
+* Print a round, or the action that matched in it
+*/
+void printMatch(const Match* match) {
+
+	char when[32];
+	time_t seconds = match->round->time / 1000000;
+	strftime(when, sizeof(when), Report::TIME, localtime(&seconds));
+	printf(Report::ROUND, when, match->round->table, match->round->round);
+
+	int length;
+	if (match->seat == ANY) {
+		for (int seat = 0; seat < HISTORY_SEATS; seat++) {
+			const char* name = seatName(match->record, seat, &length);
+			if (length > 0) {
+				printf(Report::PLAYER, length, name);
+			}
+		}
+		printf("\n");
+		return;
+	}
+
+	const char* name = seatName(match->record, match->seat, &length);
+	printf(Report::ACTION, length, name, match->hand);
+	for (int i = 0; i < match->numCards; i++) {
+		printf(Report::CARD, decodeCard(match->cards[i]).c_str());
+	}
+	printf(Report::HAND, match->soft ? Report::SOFT : Report::HARD, match->total,
+		UPCARDS[match->upcard], HISTORY_ACTIONS[match->action]);
+}
+
+#pragma endregion
+
+#pragma region Replay
+
+/*
+* Play a table again from its records, checking every round against the log
+*/
+int replay(const Options* options, const MappedFile* log, const HistoryIndex* index) {
+
+	std::cerr.rdbuf(nullptr); // The Game's reshuffle notices would slow the replay down
+	auto start = std::chrono::steady_clock::now();
+	Replay replay(*log, *index, options->replay);
+	bool same = replay.run();
+	std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+
+	if (!same) {
+		printf(Report::DIVERGED, options->replay, replay.getRounds(), replay.getFailure().c_str());
+		return EXIT_FAILURE;
+	}
+	printf(Report::REPLAYED, replay.getRounds(), options->replay, replay.getEvents(), seconds.count(),
+		replay.getRounds() / std::max(seconds.count(), 1e-9));
+	return EXIT_SUCCESS;
+}
+
+#pragma endregion
+
+/*
+* Map the log, open or build its index,
+* and print every match to the query or replay a table
+*/
+int main(int argc, char* argv[]) {
+
+	Options options = parseOptions(argc, argv);
+
+	MappedFile log;
+	if (!log.open(options.log)) {
+		printf(Report::BAD_LOG, options.log.c_str());
+		return EXIT_FAILURE;
+	}
+	HistoryIndex index;
+	openIndex(&options, &log, &index);
+	log.adviseRandom();
+	if (options.replay != ANY) {
+		return replay(&options, &log, &index);
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	HistoryQuery query(log, index, options.query);
+	long long matches = query.run([&options](const Match& match) {
+		if (!options.count) {
+			printMatch(&match);
+		}
+	});
+	std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+
+	printf(Report::SUMMARY, matches, query.getScanned(), (unsigned long long) index.getNumRecords(), seconds.count());
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,294 @@
+//------------------------------HistoryIndex.cpp--------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the implementation file for the HistoryIndex class used
+//             by the hand history tool. The index is a sidecar file next to a
+//             hand history log, built in one pass over the log. It holds an
+//             IndexRecord per round in the order the rounds were dealt, a
+//             sorted key per player and per table pointing at the ordinals of
+//             the rounds they played in, and those ordinals. Rounds are found by
+//             player or table by binary search on the keys, and by time by
+//             binary search on the IndexRecords.
+//------------------------------------------------------------------------------
+#include "HistoryIndex.h"
+#include <algorithm>
+
+//---------------------------------recordAt-------------------------------------
+//Description: Function that returns the round's record starting at an offset
+//             in the log, or nullptr if there is no whole record there.
+//Parameters:  - log:    The mapped hand history log.
+//             - offset: Where the record starts.
+//------------------------------------------------------------------------------
+const HistoryHeader* recordAt(const MappedFile &log, uint64_t offset)
+{
+    if (offset + sizeof(HistoryHeader) > log.size())
+    {
+        return nullptr;
+    }
+    const HistoryHeader* record = (const HistoryHeader*) (log.data() + offset);
+    if (record->magic != HISTORY_MAGIC || record->size < sizeof(HistoryHeader) + record->numEvents * sizeof(HistoryEvent)
+        || record->size % HISTORY_ALIGN != 0 || offset + record->size > log.size())
+    {
+        return nullptr;
+    }
+    return record;
+} // end of recordAt
+
+//---------------------------------seatName-------------------------------------
+//Description: Function that returns the name of the player at a seat in a
+//             round's record, not null terminated, and its length; 0 if nobody
+//             sat there.
+//Parameters:  - record: The round's record.
+//             - seat:   Seat at the table.
+//             - length: Set to the bytes in the name.
+//------------------------------------------------------------------------------
+const char* seatName(const HistoryHeader* record, int seat, int* length)
+{
+    const char* end = (const char*) record + record->size;
+    const char* name = (const char*) record + sizeof(HistoryHeader) + record->numEvents * sizeof(HistoryEvent);
+    for (int i = 0; i < HISTORY_SEATS && name < end; i++)
+    {
+        int size = (uint8_t) *name++;
+        if (name + size > end)
+        {
+            break;
+        }
+        if (i == seat)
+        {
+            *length = size;
+            return name;
+        }
+        name += size;
+    }
+    *length = 0;
+    return "";
+} // end of seatName
+
+//-------------------------------HistoryIndex-----------------------------------
+//Description: Constructor for HistoryIndex. Nothing is read until it is opened.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+HistoryIndex::HistoryIndex()
+{
+    this->header = nullptr;
+    this->records = nullptr;
+    this->players = nullptr;
+    this->tables = nullptr;
+    this->postings = nullptr;
+} // end of HistoryIndex
+
+//--------------------------------getLogSize------------------------------------
+//Description: Public function that returns the bytes of the log the index
+//             covers.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+uint64_t HistoryIndex::getLogSize() const
+{
+    return this->header->logSize;
+} // end of getLogSize
+
+//-------------------------------getNumRecords----------------------------------
+//Description: Public function that returns the number of rounds indexed.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+uint64_t HistoryIndex::getNumRecords() const
+{
+    return this->header->numRecords;
+} // end of getNumRecords
+
+//---------------------------------getRecord------------------------------------
+//Description: Public function that returns a round by its ordinal in the order
+//             the rounds were dealt.
+//Parameters:  - ordinal: Round's ordinal.
+//------------------------------------------------------------------------------
+const IndexRecord &HistoryIndex::getRecord(uint64_t ordinal) const
+{
+    return this->records[ordinal];
+} // end of getRecord
+
+//--------------------------------findPlayer------------------------------------
+//Description: Public function that returns the ordinals of the rounds a player
+//             sat in, in the order dealt, or nullptr if they never played.
+//Parameters:  - name:  Player's username.
+//             - count: Set to the number of rounds.
+//------------------------------------------------------------------------------
+const uint64_t* HistoryIndex::findPlayer(const string &name, uint64_t* count) const
+{
+    string key = name.substr(0, HISTORY_NAME_SIZE);
+    const PlayerKey* end = this->players + this->header->numPlayers;
+    const PlayerKey* found = lower_bound(this->players, end, key, [](const PlayerKey &player, const string &key)
+    {
+        return key.compare(0, key.size(), player.name, player.length) > 0;
+    });
+    *count = 0;
+    if (found == end || key.compare(0, key.size(), found->name, found->length) != 0)
+    {
+        return nullptr;
+    }
+    *count = found->count;
+    return this->postings + found->first;
+} // end of findPlayer
+
+//---------------------------------findTable------------------------------------
+//Description: Public function that returns the ordinals of the rounds played at
+//             a table, in the order dealt, or nullptr if it never played one.
+//Parameters:  - table: Game ID of the table.
+//             - count: Set to the number of rounds.
+//------------------------------------------------------------------------------
+const uint64_t* HistoryIndex::findTable(uint32_t table, uint64_t* count) const
+{
+    const TableKey* end = this->tables + this->header->numTables;
+    const TableKey* found = lower_bound(this->tables, end, table, [](const TableKey &key, uint32_t table)
+    {
+        return key.table < table;
+    });
+    *count = 0;
+    if (found == end || found->table != table)
+    {
+        return nullptr;
+    }
+    *count = found->count;
+    return this->postings + found->first;
+} // end of findTable
+
+//-------------------------------firstAtOrAfter---------------------------------
+//Description: Public function that returns the ordinal of the first round dealt
+//             at or after a time, or the number of rounds if there is none.
+//Parameters:  - time: Microseconds since the epoch.
+//------------------------------------------------------------------------------
+uint64_t HistoryIndex::firstAtOrAfter(int64_t time) const
+{
+    const IndexRecord* end = this->records + this->header->numRecords;
+    return lower_bound(this->records, end, time, [](const IndexRecord &record, int64_t time)
+    {
+        return record.time < time;
+    }) - this->records;
+} // end of firstAtOrAfter
+
+//-----------------------------------open---------------------------------------
+//Description: Public function that maps an index file. Returns false if it
+//             can't be read or isn't an index of this version.
+//Parameters:  - path: Path of the index file.
+//------------------------------------------------------------------------------
+bool HistoryIndex::open(const string &path)
+{
+    if (!this->file.open(path) || this->file.size() < sizeof(IndexHeader))
+    {
+        return false;
+    }
+    this->header = (const IndexHeader*) this->file.data();
+    if (memcmp(this->header->magic, INDEX_MAGIC, sizeof(INDEX_MAGIC)) != 0 || this->header->version != INDEX_VERSION)
+    {
+        return false;
+    }
+    uint64_t size = sizeof(IndexHeader) + this->header->numRecords * sizeof(IndexRecord)
+        + this->header->numPlayers * sizeof(PlayerKey) + this->header->numTables * sizeof(TableKey)
+        + this->header->numPostings * sizeof(uint64_t);
+    if (size != this->file.size())
+    {
+        return false;
+    }
+    this->records = (const IndexRecord*) (this->header + 1);
+    this->players = (const PlayerKey*) (this->records + this->header->numRecords);
+    this->tables = (const TableKey*) (this->players + this->header->numPlayers);
+    this->postings = (const uint64_t*) (this->tables + this->header->numTables);
+    this->file.adviseRandom();
+    return true;
+} // end of open
+
+//-----------------------------------build--------------------------------------
+//Description: Public function that reads a whole log front to back and writes
+//             its index, to a temporary file renamed over the old index. A log
+//             cut off mid record is indexed up to the last whole one. Returns
+//             false if the index can't be written.
+//Parameters:  - log:  The mapped hand history log.
+//             - path: Path of the index file.
+//------------------------------------------------------------------------------
+bool HistoryIndex::build(const MappedFile &log, const string &path)
+{
+    vector<IndexRecord> records;
+    log.adviseSequential();
+    uint64_t offset = 0;
+    for (const HistoryHeader* record = recordAt(log, offset); record != nullptr; record = recordAt(log, offset))
+    {
+        IndexRecord entry = { offset, record->time, record->table, record->round, 0, 0 };
+        const HistoryEvent* events = (const HistoryEvent*) (record + 1);
+        for (int i = 0; i < record->numEvents; i++)
+        {
+            entry.actions |= 1u << (int) events[i].action;
+        }
+        records.push_back(entry);
+        offset += record->size;
+    }
+    stable_sort(records.begin(), records.end(), [](const IndexRecord &a, const IndexRecord &b)
+    {
+        return a.time < b.time;
+    });
+
+    map<string, vector<uint64_t>> byPlayer;
+    map<uint32_t, vector<uint64_t>> byTable;
+    for (uint64_t i = 0; i < records.size(); i++)
+    {
+        const HistoryHeader* record = (const HistoryHeader*) (log.data() + records[i].offset);
+        for (int seat = 0; seat < HISTORY_SEATS; seat++)
+        {
+            int length;
+            const char* name = seatName(record, seat, &length);
+            if (length > 0)
+            {
+                byPlayer[string(name, length)].push_back(i);
+            }
+        }
+        byTable[records[i].table].push_back(i);
+    }
+
+    IndexHeader header;
+    memcpy(header.magic, INDEX_MAGIC, sizeof(INDEX_MAGIC));
+    header.version = INDEX_VERSION;
+    header.logSize = offset;
+    header.numRecords = records.size();
+    header.numPlayers = byPlayer.size();
+    header.numTables = byTable.size();
+    header.numPostings = 0;
+    vector<PlayerKey> players;
+    for (const auto &player : byPlayer)
+    {
+        PlayerKey key;
+        memset(&key, 0, sizeof(key));
+        memcpy(key.name, player.first.data(), player.first.size());
+        key.length = player.first.size();
+        key.first = header.numPostings;
+        key.count = player.second.size();
+        header.numPostings += key.count;
+        players.push_back(key);
+    }
+    vector<TableKey> tables;
+    for (const auto &table : byTable)
+    {
+        TableKey key = { table.first, 0, header.numPostings, table.second.size() };
+        header.numPostings += key.count;
+        tables.push_back(key);
+    }
+
+    string temporary = path + ".tmp";
+    ofstream out(temporary, ios::binary | ios::trunc);
+    out.write((const char*) &header, sizeof(header));
+    out.write((const char*) records.data(), records.size() * sizeof(IndexRecord));
+    out.write((const char*) players.data(), players.size() * sizeof(PlayerKey));
+    out.write((const char*) tables.data(), tables.size() * sizeof(TableKey));
+    for (const auto &player : byPlayer)
+    {
+        out.write((const char*) player.second.data(), player.second.size() * sizeof(uint64_t));
+    }
+    for (const auto &table : byTable)
+    {
+        out.write((const char*) table.second.data(), table.second.size() * sizeof(uint64_t));
+    }
+    out.close();
+    if (!out || rename(temporary.c_str(), path.c_str()) != 0)
+    {
+        remove(temporary.c_str());
+        return false;
+    }
+    return true;
+} // end of build
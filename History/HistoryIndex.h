@@ -0,0 +1,106 @@
+//-------------------------------HistoryIndex.h---------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the header file for the HistoryIndex class used by the
+//             hand history tool. The index is a sidecar file next to a hand
+//             history log, built in one pass over the log. It holds an
+//             IndexRecord per round in the order the rounds were dealt, with
+//             the round's offset in the log, time, table, round number and a
+//             bit for every kind of action taken, so rounds can be picked out
+//             without touching the log; a sorted key per player and per table
+//             pointing at the ordinals of the rounds they played in; and those
+//             ordinals. Rounds are found by player or table by binary search on
+//             the keys, and by time by binary search on the IndexRecords. The
+//             server logs rounds as they are settled, so tables playing at once
+//             interleave out of time order in the log; sorting the IndexRecords
+//             by time puts them back. The index remembers how much of the log
+//             it covers and is rebuilt once the log grows. Both files are read
+//             through a MappedFile.
+//------------------------------------------------------------------------------
+#ifndef HISTORYINDEX_H
+#define HISTORYINDEX_H
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <string>
+#include <map>
+#include <vector>
+#include <fstream>
+#include "MappedFile.h"
+#include "HandHistory.h"
+using namespace std;
+
+static const char INDEX_MAGIC[4] = { 'B', 'J', 'H', 'I' };
+static const uint32_t INDEX_VERSION = 1;
+static const char* const INDEX_SUFFIX = ".idx";    //Appended to the log's path for its index
+
+//Start of the index file
+struct IndexHeader
+{
+    char magic[4];              //INDEX_MAGIC
+    uint32_t version;           //INDEX_VERSION
+    uint64_t logSize;           //Bytes of the log the index covers
+    uint64_t numRecords;        //IndexRecords after the header
+    uint64_t numPlayers;        //PlayerKeys after the IndexRecords
+    uint64_t numTables;         //TableKeys after the PlayerKeys
+    uint64_t numPostings;       //Round ordinals after the TableKeys
+};
+
+//One round of the log
+struct IndexRecord
+{
+    uint64_t offset;            //Where the round's record starts in the log
+    int64_t time;               //Microseconds since the epoch when the round was dealt
+    uint32_t table;             //Game ID of the table
+    uint32_t round;             //Game's round number
+    uint32_t actions;           //Bit (1 << action) for every HistoryAction in the round
+    uint32_t padding;
+};
+
+//Rounds a player sat in, sorted by name
+struct PlayerKey
+{
+    char name[HISTORY_NAME_SIZE + 6];   //Name, null padded
+    uint16_t length;                    //Bytes in the name
+    uint64_t first;                     //First of the player's ordinals in the postings
+    uint64_t count;                     //Number of rounds
+};
+
+//Rounds played at a table, sorted by Game ID
+struct TableKey
+{
+    uint32_t table;             //Game ID
+    uint32_t padding;
+    uint64_t first;             //First of the table's ordinals in the postings
+    uint64_t count;             //Number of rounds
+};
+
+const HistoryHeader* recordAt(const MappedFile &log, uint64_t offset);
+const char* seatName(const HistoryHeader* record, int seat, int* length);
+
+class HistoryIndex
+{
+    private:
+        MappedFile file;                    //The index file
+        const IndexHeader* header;          //Header at the start of the file
+        const IndexRecord* records;         //Every round in the order dealt
+        const PlayerKey* players;           //Keys sorted by name
+        const TableKey* tables;             //Keys sorted by Game ID
+        const uint64_t* postings;           //Round ordinals, sorted within each key
+
+    public:
+        //Constructors
+        HistoryIndex();
+        //Getters
+        uint64_t getLogSize() const;
+        uint64_t getNumRecords() const;
+        const IndexRecord &getRecord(uint64_t ordinal) const;
+        const uint64_t* findPlayer(const string &name, uint64_t* count) const;
+        const uint64_t* findTable(uint32_t table, uint64_t* count) const;
+        uint64_t firstAtOrAfter(int64_t time) const;
+
+        //Setters
+        bool open(const string &path);
+        static bool build(const MappedFile &log, const string &path);
+};
+#endif
@@ -0,0 +1,227 @@
+//------------------------------HistoryQuery.cpp--------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the implementation file for the HistoryQuery class used
+//             by the hand history tool. The index narrows the rounds down by
+//             player, table, time range and action bits, and only the rounds
+//             left are read from the log, replaying their events to know every
+//             hand's cards at the moment of each action. Every match is handed
+//             to a visitor as it is found.
+//------------------------------------------------------------------------------
+#include "HistoryQuery.h"
+#include <algorithm>
+
+//---------------------------------cardRank-------------------------------------
+//Description: Helper that returns the rank of a logged card code, 1 for an Ace
+//             through 10 for 10, J, Q and K.
+//Parameters:  - code: Card code from encodeCard.
+//------------------------------------------------------------------------------
+static int cardRank(uint8_t code)
+{
+    int face = code % 13;
+    return face >= 9 ? 10 : face + 1;
+} // end of cardRank
+
+//-------------------------------HistoryQuery-----------------------------------
+//Description: Constructor for HistoryQuery.
+//Parameters:  - log:   The hand history log.
+//             - index: The log's index.
+//             - query: What to look for.
+//------------------------------------------------------------------------------
+HistoryQuery::HistoryQuery(const MappedFile &log, const HistoryIndex &index, const Query &query)
+    : log(log), index(index), query(query)
+{
+    this->scanned = 0;
+} // end of HistoryQuery
+
+//--------------------------------getScanned------------------------------------
+//Description: Public function that returns the rounds read from the log by the
+//             last run.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+long long HistoryQuery::getScanned() const
+{
+    return this->scanned;
+} // end of getScanned
+
+//------------------------------------run---------------------------------------
+//Description: Public function that finds every match, in the order the rounds
+//             were dealt, and returns how many there were.
+//Parameters:  - visit: Called with each match as it is found.
+//------------------------------------------------------------------------------
+long long HistoryQuery::run(const function<void(const Match &)> &visit)
+{
+    this->scanned = 0;
+    uint64_t first = index.firstAtOrAfter(query.from);
+    uint64_t last = query.to == LLONG_MAX ? index.getNumRecords() : index.firstAtOrAfter(query.to + 1);
+    long long matches = 0;
+    if (first >= last)
+    {
+        return 0;
+    }
+
+    const uint64_t* postings = nullptr;
+    uint64_t count = 0;
+    const uint64_t* others = nullptr;
+    uint64_t numOthers = 0;
+    if (!query.player.empty())
+    {
+        postings = index.findPlayer(query.player, &count);
+        if (query.table != ANY)
+        {
+            others = index.findTable(query.table, &numOthers);
+        }
+        if (postings == nullptr || (query.table != ANY && others == nullptr))
+        {
+            return 0;
+        }
+    }
+    else if (query.table != ANY)
+    {
+        postings = index.findTable(query.table, &count);
+        if (postings == nullptr)
+        {
+            return 0;
+        }
+    }
+
+    if (postings == nullptr)
+    {
+        for (uint64_t ordinal = first; ordinal < last; ordinal++)
+        {
+            visitRound(ordinal, visit, &matches);
+        }
+        return matches;
+    }
+    const uint64_t* end = postings + count;
+    const uint64_t* other = others;
+    const uint64_t* otherEnd = others + numOthers;
+    for (const uint64_t* next = lower_bound(postings, end, first); next != end && *next < last; next++)
+    {
+        if (others != nullptr)
+        { //Both a player and a table: walk the two sorted lists together
+            while (other != otherEnd && *other < *next)
+            {
+                other++;
+            }
+            if (other == otherEnd)
+            {
+                break;
+            }
+            if (*other != *next)
+            {
+                continue;
+            }
+        }
+        visitRound(*next, visit, &matches);
+    }
+    return matches;
+} // end of run
+
+//---------------------------------sitsAt---------------------------------------
+//Description: Private function that returns whether or not the queried player
+//             sat at a seat in a round, or true if no player was queried.
+//Parameters:  - record: The round's record.
+//             - seat:   Seat at the table.
+//------------------------------------------------------------------------------
+bool HistoryQuery::sitsAt(const HistoryHeader* record, int seat) const
+{
+    if (query.player.empty())
+    {
+        return true;
+    }
+    int length;
+    const char* name = seatName(record, seat, &length);
+    return query.player.compare(0, HISTORY_NAME_SIZE, name, length) == 0;
+} // end of sitsAt
+
+//--------------------------------visitRound------------------------------------
+//Description: Private function that checks one round against the query, first
+//             by its index entry and then, if that passes, by replaying its
+//             events. Returns false if the round was skipped without reading
+//             the log.
+//Parameters:  - ordinal: Round's ordinal in the index.
+//             - visit:   Called with each match.
+//             - matches: Incremented for each match.
+//------------------------------------------------------------------------------
+bool HistoryQuery::visitRound(uint64_t ordinal, const function<void(const Match &)> &visit, long long* matches)
+{
+    const IndexRecord &round = index.getRecord(ordinal);
+    if ((query.table != ANY && round.table != query.table) || (query.action != ANY && !(round.actions & (1u << query.action))))
+    {
+        return false;
+    }
+    const HistoryHeader* record = recordAt(log, round.offset);
+    if (record == nullptr)
+    {
+        return false;
+    }
+    this->scanned++;
+    if (query.action == ANY)
+    {
+        (*matches)++;
+        visit(Match{ &round, record, ANY, ANY, 0, 0, false, 0, nullptr, 0 });
+        return true;
+    }
+
+    uint8_t cards[HISTORY_SEATS][MAX_LOGGED_HANDS][MAX_LOGGED_CARDS];
+    int numCards[HISTORY_SEATS][MAX_LOGGED_HANDS] = {};
+    int upcard = 0;
+    const HistoryEvent* events = (const HistoryEvent*) (record + 1);
+    for (int i = 0; i < record->numEvents; i++)
+    {
+        const HistoryEvent &event = events[i];
+        if (event.seat == HISTORY_DEALER)
+        {
+            if (event.action == HistoryAction::DEAL && upcard == 0)
+            {
+                upcard = cardRank(event.card);
+            }
+            continue;
+        }
+        if (event.seat >= HISTORY_SEATS || event.hand >= MAX_LOGGED_HANDS)
+        {
+            continue;
+        }
+        int* held = &numCards[event.seat][event.hand];
+        if (event.action == HistoryAction::DEAL)
+        {
+            if (*held < MAX_LOGGED_CARDS)
+            {
+                cards[event.seat][event.hand][(*held)++] = event.card;
+            }
+            continue;
+        }
+        bool split = event.action == HistoryAction::SPLIT;
+        if (split && (event.amount < 0 || event.amount >= MAX_LOGGED_HANDS))
+        {
+            continue;
+        }
+        int hand = split ? event.amount : event.hand; //A split is taken on the pair's hand
+        if ((int) event.action == query.action && sitsAt(record, event.seat))
+        {
+            const uint8_t* played = cards[event.seat][hand];
+            int numPlayed = numCards[event.seat][hand];
+            int total = 0;
+            bool ace = false;
+            for (int c = 0; c < numPlayed; c++)
+            {
+                total += cardRank(played[c]);
+                ace = ace || cardRank(played[c]) == ACE;
+            }
+            bool soft = ace && total + SOFT_BONUS <= BLACKJACK;
+            total += soft ? SOFT_BONUS : 0;
+            if ((query.total == ANY || query.total == total) && (query.upcard == ANY || query.upcard == upcard))
+            {
+                (*matches)++;
+                visit(Match{ &round, record, event.seat, (int) event.action, hand, total, soft, upcard, played, numPlayed });
+            }
+        }
+        if (split && numCards[event.seat][hand] > 0)
+        { //The second card of the pair moves to the new hand
+            cards[event.seat][event.hand][0] = cards[event.seat][hand][--numCards[event.seat][hand]];
+            *held = 1;
+        }
+    }
+    return true;
+} // end of visitRound
@@ -0,0 +1,77 @@
+//-------------------------------HistoryQuery.h---------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the header file for the HistoryQuery class used by the
+//             hand history tool. A Query names a player, a table, a time range,
+//             an action, and the hand's total and dealer's upcard when the
+//             action was taken, any of which may be left out. The index narrows
+//             the rounds down first: the player's or table's ordinals (merged
+//             when both are given), cut to the time range by binary search as
+//             ordinals run in the order the rounds were dealt, and dropped
+//             unless the round's action bits hold the action. Only the rounds
+//             left are read from the log, replaying their events to know every
+//             hand's cards at the moment of each action. Every match is handed
+//             to a visitor as it is found, so nothing is kept in memory.
+//------------------------------------------------------------------------------
+#ifndef HISTORYQUERY_H
+#define HISTORYQUERY_H
+#include <cstdint>
+#include <climits>
+#include <string>
+#include <functional>
+#include "MappedFile.h"
+#include "HistoryIndex.h"
+#include "Rules.h"
+using namespace std;
+
+static const int ANY = -1;                  //A Query value that matches anything
+static const int MAX_LOGGED_HANDS = 8;      //Hands per seat replayed, as many as a split seat can play
+static const int MAX_LOGGED_CARDS = 22;     //Cards per hand replayed: 21 Aces and the card that BUSTs
+
+//What to look for
+struct Query
+{
+    string player;                  //Username, empty for anyone
+    long long table = ANY;          //Game ID of the table
+    int64_t from = LLONG_MIN;       //Earliest time dealt, microseconds since the epoch
+    int64_t to = LLONG_MAX;         //Latest time dealt, microseconds since the epoch
+    int action = ANY;               //HistoryAction taken, ANY to match whole rounds
+    int total = ANY;                //Hand's total when the action was taken
+    int upcard = ANY;               //Rank of the dealer's upcard, 1 for an Ace
+};
+
+//A round, or an action in a round, that matched
+struct Match
+{
+    const IndexRecord* round;       //The round in the index
+    const HistoryHeader* record;    //The round's record in the log
+    int seat;                       //Seat the action was taken at, ANY for a whole round
+    int action;                     //HistoryAction taken
+    int hand;                       //Hand the action was taken on
+    int total;                      //Hand's total before the action
+    bool soft;                      //Whether or not an Ace counted as 11 in the total
+    int upcard;                     //Rank of the dealer's upcard, 0 if not dealt yet
+    const uint8_t* cards;           //Card codes of the hand before the action
+    int numCards;                   //Cards in the hand
+};
+
+class HistoryQuery
+{
+    private:
+        const MappedFile &log;          //The hand history log
+        const HistoryIndex &index;      //The log's index
+        Query query;                    //What to look for
+        long long scanned;              //Rounds read from the log
+        bool visitRound(uint64_t ordinal, const function<void(const Match &)> &visit, long long* matches);
+        bool sitsAt(const HistoryHeader* record, int seat) const;
+
+    public:
+        //Constructors
+        HistoryQuery(const MappedFile &log, const HistoryIndex &index, const Query &query);
+        //Getters
+        long long getScanned() const;
+
+        //Setters
+        long long run(const function<void(const Match &)> &visit);
+};
+#endif
@@ -0,0 +1,136 @@
+//------------------------------MappedFile.cpp----------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the implementation file for the MappedFile class used by
+//             the hand history tool. It maps a whole file read-only into memory,
+//             so the hand history log and its index are read straight out of
+//             the page cache instead of being loaded into RAM, and tells the
+//             kernel whether the file will be read front to back or jumped
+//             around in.
+//------------------------------------------------------------------------------
+#include "MappedFile.h"
+
+//--------------------------------MappedFile------------------------------------
+//Description: Constructor for MappedFile. Nothing is mapped until it is opened.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+MappedFile::MappedFile()
+{
+    this->bytes = nullptr;
+    this->length = 0;
+} // end of MappedFile
+
+//-------------------------------~MappedFile------------------------------------
+//Description: Destructor for MappedFile. Unmaps the file.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+MappedFile::~MappedFile()
+{
+    close();
+} // end of ~MappedFile
+
+//-----------------------------------data---------------------------------------
+//Description: Public function that returns the start of the mapped file.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+const char* MappedFile::data() const
+{
+    return this->bytes;
+} // end of data
+
+//-----------------------------------size---------------------------------------
+//Description: Public function that returns the bytes in the mapped file.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+size_t MappedFile::size() const
+{
+    return this->length;
+} // end of size
+
+//----------------------------------isOpen--------------------------------------
+//Description: Public function that returns whether or not a file is mapped. An
+//             empty file counts as open with nothing in it.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+bool MappedFile::isOpen() const
+{
+    return this->bytes != nullptr;
+} // end of isOpen
+
+//-----------------------------------open---------------------------------------
+//Description: Public function that maps the whole of a file, unmapping any file
+//             mapped before. Returns false if it can't be opened.
+//Parameters:  - path: Path of the file.
+//------------------------------------------------------------------------------
+bool MappedFile::open(const string &path)
+{
+    close();
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0)
+    {
+        ::close(fd);
+        return false;
+    }
+    this->length = info.st_size;
+    if (this->length == 0)
+    {
+        static const char EMPTY = '\0';
+        this->bytes = &EMPTY;
+        ::close(fd);
+        return true;
+    }
+    void* mapping = mmap(nullptr, this->length, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED)
+    {
+        this->length = 0;
+        return false;
+    }
+    this->bytes = (const char*) mapping;
+    return true;
+} // end of open
+
+//-----------------------------------close--------------------------------------
+//Description: Public function that unmaps the file, if one is mapped.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+void MappedFile::close()
+{
+    if (this->bytes != nullptr && this->length > 0)
+    {
+        munmap((void*) this->bytes, this->length);
+    }
+    this->bytes = nullptr;
+    this->length = 0;
+} // end of close
+
+//-----------------------------adviseSequential---------------------------------
+//Description: Public function that tells the kernel the file will be read front
+//             to back, so it reads ahead and drops pages already passed.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+void MappedFile::adviseSequential() const
+{
+    if (this->length > 0)
+    {
+        madvise((void*) this->bytes, this->length, MADV_SEQUENTIAL);
+    }
+} // end of adviseSequential
+
+//-------------------------------adviseRandom-----------------------------------
+//Description: Public function that tells the kernel the file will be read in
+//             places, so it doesn't read ahead of each one.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+void MappedFile::adviseRandom() const
+{
+    if (this->length > 0)
+    {
+        madvise((void*) this->bytes, this->length, MADV_RANDOM);
+    }
+} // end of adviseRandom
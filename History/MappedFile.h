@@ -0,0 +1,43 @@
+//-------------------------------MappedFile.h-----------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the header file for the MappedFile class used by the
+//             hand history tool. It maps a whole file read-only into memory, so
+//             the hand history log and its index are read straight out of the
+//             page cache instead of being loaded into RAM, and tells the kernel
+//             whether the file will be read front to back or jumped around in.
+//------------------------------------------------------------------------------
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+#include <cstddef>
+#include <string>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+using namespace std;
+
+class MappedFile
+{
+    private:
+        const char* bytes;      //Start of the mapping, nullptr if nothing is mapped
+        size_t length;          //Bytes mapped
+
+    public:
+        //Constructors
+        MappedFile();
+        MappedFile(const MappedFile &file) = delete;
+        MappedFile &operator=(const MappedFile &file) = delete;
+        ~MappedFile();
+        //Getters
+        const char* data() const;
+        size_t size() const;
+        bool isOpen() const;
+
+        //Setters
+        bool open(const string &path);
+        void close();
+        void adviseSequential() const;
+        void adviseRandom() const;
+};
+#endif
@@ -0,0 +1,324 @@
+//---------------------------------Replay.cpp-----------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the implementation file for the Replay class used by the
+//             hand history tool. A Game is built with the rules and shoe seed
+//             the table's first round was logged with, and each of its rounds
+//             is played again from the log: players sit down and leave where
+//             they were logged to, bets and actions go to the Game in the order
+//             logged, and the Game deals, plays the dealer and settles on its
+//             own. Its record of the round is then checked against the logged
+//             one, and the first event that differs is reported.
+//------------------------------------------------------------------------------
+#include "Replay.h"
+
+//----------------------------------Replay--------------------------------------
+//Description: Constructor for Replay.
+//Parameters:  - log:   The hand history log.
+//             - index: The log's index.
+//             - table: Game ID of the table to play again.
+//------------------------------------------------------------------------------
+Replay::Replay(const MappedFile &log, const HistoryIndex &index, uint32_t table)
+    : log(log), index(index), table(table)
+{
+    this->rounds = 0;
+    this->events = 0;
+} // end of Replay
+
+//---------------------------------getRounds------------------------------------
+//Description: Public function that returns the rounds the last run replayed
+//             and found the same as logged.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+long long Replay::getRounds() const
+{
+    return this->rounds;
+} // end of getRounds
+
+//---------------------------------getEvents------------------------------------
+//Description: Public function that returns the events checked by the last run.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+long long Replay::getEvents() const
+{
+    return this->events;
+} // end of getEvents
+
+//--------------------------------getFailure------------------------------------
+//Description: Public function that returns why the last run stopped short, or
+//             an empty string if every round was the same as logged.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+const string &Replay::getFailure() const
+{
+    return this->failure;
+} // end of getFailure
+
+//------------------------------------run---------------------------------------
+//Description: Public function that plays every round of the table again in the
+//             order dealt. Returns false at the first round that can't be
+//             replayed or comes out differently than logged.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+bool Replay::run()
+{
+    this->rounds = 0;
+    this->events = 0;
+    this->failure.clear();
+    for (int seat = 0; seat < HISTORY_SEATS; seat++)
+    {
+        seated[seat].clear();
+    }
+
+    uint64_t count;
+    const uint64_t* ordinals = index.findTable(this->table, &count);
+    const HistoryHeader* first = ordinals != nullptr ? recordAt(log, index.getRecord(ordinals[0]).offset) : nullptr;
+    if (first == nullptr)
+    {
+        this->failure = "the table played no rounds";
+        return false;
+    }
+    if (first->round != 1)
+    {
+        return fail(first, "the rounds before it are missing from the log");
+    }
+    Game game(string(), this->table, loggedRules(first), nullptr, nullptr, nullptr, first->seed);
+    game.removePlayer(string()); //Players sit down as the log says
+    game.setRecording(true);
+
+    for (uint64_t i = 0; i < count; i++)
+    {
+        const HistoryHeader* logged = recordAt(log, index.getRecord(ordinals[i]).offset);
+        if (logged == nullptr)
+        {
+            this->failure = "the log is shorter than its index";
+            return false;
+        }
+        if (logged->round != this->rounds + 1)
+        {
+            return fail(logged, "the rounds before it are missing from the log");
+        }
+        if (logged->flags & HISTORY_TRUNCATED)
+        {
+            return fail(logged, "its record was truncated");
+        }
+        if (!replayRound(game, logged))
+        {
+            return false;
+        }
+        this->rounds++;
+        this->events += logged->numEvents;
+    }
+    return true;
+} // end of run
+
+//--------------------------------replayRound-----------------------------------
+//Description: Private function that plays one round again: seats the players
+//             as logged, places the bets, deals, takes each logged action, plays
+//             the dealer and settles, then checks the Game's record of it.
+//Parameters:  - game:   The replayed table.
+//             - logged: The round's record in the log.
+//------------------------------------------------------------------------------
+bool Replay::replayRound(Game &game, const HistoryHeader* logged)
+{
+    const HistoryEvent* events = (const HistoryEvent*) (logged + 1);
+    string names[HISTORY_SEATS];
+    bool sits[HISTORY_SEATS] = {};
+    for (int seat = 0; seat < HISTORY_SEATS; seat++)
+    {
+        int length;
+        const char* name = seatName(logged, seat, &length);
+        names[seat].assign(name, length);
+    }
+    for (int i = 0; i < logged->numEvents && events[i].action != HistoryAction::DEAL; i++)
+    {
+        if (events[i].action == HistoryAction::SIT && events[i].seat < HISTORY_SEATS)
+        {
+            sits[events[i].seat] = true;
+        }
+    }
+    for (int seat = 0; seat < HISTORY_SEATS; seat++)
+    { //Players who left between rounds, or left and sat down again
+        if (!seated[seat].empty() && (seated[seat] != names[seat] || sits[seat]))
+        {
+            game.removePlayer(seated[seat]);
+            seated[seat].clear();
+        }
+    }
+
+    bool dealt = false;
+    for (int i = 0; i < logged->numEvents; i++)
+    {
+        const HistoryEvent &event = events[i];
+        if (event.seat >= HISTORY_SEATS && event.seat != HISTORY_DEALER)
+        {
+            return fail(logged, "an event was logged at no seat: ", describe(event));
+        }
+        if (event.action == HistoryAction::DEAL && !dealt)
+        {
+            for (int seat = 0; seat < HISTORY_SEATS; seat++)
+            {
+                if (seated[seat] != names[seat])
+                {
+                    return fail(logged, "a player was seated without sitting down: ", names[seat]);
+                }
+            }
+            game.startRound();
+            dealt = true;
+        }
+        const string &name = event.seat < HISTORY_SEATS ? names[event.seat] : names[0];
+        switch (event.action)
+        {
+            case HistoryAction::SIT:
+            {
+                Player player(name);
+                int balance = player.getBalance();
+                if (event.amount > balance)
+                {
+                    player.addBalance(event.amount - balance);
+                }
+                else
+                {
+                    player.removeBalance(balance - event.amount);
+                }
+                if (!game.seatPlayer(player, event.seat))
+                {
+                    return fail(logged, "a player sat down at a taken seat: ", describe(event));
+                }
+                seated[event.seat] = name;
+                break;
+            }
+            case HistoryAction::BET:
+                game.placeBet(name, event.amount);
+                break;
+            case HistoryAction::HIT:
+                game.hit(name);
+                break;
+            case HistoryAction::STAND:
+                game.stand(name);
+                break;
+            case HistoryAction::SPLIT:
+                game.split(name);
+                break;
+            case HistoryAction::DOUBLE_DOWN:
+                game.doubleDown(name);
+                break;
+            case HistoryAction::SURRENDER:
+                game.surrender(name);
+                break;
+            case HistoryAction::LEAVE:
+                game.removePlayer(name);
+                seated[event.seat].clear();
+                break;
+            default: //Cards and settlements come from the Game, checked below
+                break;
+        }
+    }
+    if (!dealt)
+    {
+        return fail(logged, "no cards were dealt");
+    }
+    game.dealerActions();
+    game.settleBets();
+
+    const char* replayed;
+    if (game.getLastRecord(&replayed) == 0)
+    {
+        return fail(logged, "the replayed round was not recorded");
+    }
+    return compare(logged, (const HistoryHeader*) replayed);
+} // end of replayRound
+
+//----------------------------------compare-------------------------------------
+//Description: Private function that checks the replayed record of a round
+//             against the logged one, all but the time it was dealt.
+//Parameters:  - logged:   The round's record in the log.
+//             - replayed: The Game's record of the replayed round.
+//------------------------------------------------------------------------------
+bool Replay::compare(const HistoryHeader* logged, const HistoryHeader* replayed)
+{
+    HistoryHeader expected = *logged;
+    HistoryHeader actual = *replayed;
+    expected.time = actual.time = 0;
+    expected.size = actual.size = 0;
+    expected.numEvents = actual.numEvents = 0;
+    if (memcmp(&expected, &actual, sizeof(HistoryHeader)) != 0)
+    {
+        return fail(logged, "the round began differently, ", "logged with " + to_string(logged->shoeCards)
+            + " cards in the shoe, replayed with " + to_string(replayed->shoeCards));
+    }
+
+    const HistoryEvent* loggedEvents = (const HistoryEvent*) (logged + 1);
+    const HistoryEvent* replayedEvents = (const HistoryEvent*) (replayed + 1);
+    for (int i = 0; i < logged->numEvents && i < replayed->numEvents; i++)
+    {
+        if (memcmp(&loggedEvents[i], &replayedEvents[i], sizeof(HistoryEvent)) != 0)
+        {
+            return fail(logged, "event ", to_string(i) + " differs, logged " + describe(loggedEvents[i])
+                + ", replayed " + describe(replayedEvents[i]));
+        }
+    }
+    if (logged->numEvents != replayed->numEvents)
+    {
+        return fail(logged, "the events differ in number, ", "logged " + to_string(logged->numEvents)
+            + ", replayed " + to_string(replayed->numEvents));
+    }
+    size_t names = sizeof(HistoryHeader) + logged->numEvents * sizeof(HistoryEvent);
+    if (logged->size != replayed->size || memcmp((const char*) logged + names, (const char*) replayed + names, logged->size - names) != 0)
+    {
+        return fail(logged, "the players seated differ");
+    }
+    return true;
+} // end of compare
+
+//-----------------------------------fail---------------------------------------
+//Description: Private function that keeps why the replay stopped at a round,
+//             and returns false.
+//Parameters:  - logged: The round's record in the log.
+//             - reason: What went wrong.
+//             - detail: More on what went wrong, if anything.
+//------------------------------------------------------------------------------
+bool Replay::fail(const HistoryHeader* logged, const char* reason, const string &detail)
+{
+    this->failure = "round " + to_string(logged->round) + ": " + reason + detail;
+    return false;
+} // end of fail
+
+//--------------------------------loggedRules-----------------------------------
+//Description: Private function that returns the rules a round was logged with,
+//             by name if they are one of the server's variants.
+//Parameters:  - logged: The round's record in the log.
+//------------------------------------------------------------------------------
+TableRules Replay::loggedRules(const HistoryHeader* logged)
+{
+    TableRules rules = { "logged", logged->decks, (logged->rules & HISTORY_HIT_SOFT_17) != 0,
+        (logged->rules & HISTORY_DOUBLE_AFTER_SPLIT) != 0, (logged->rules & HISTORY_LATE_SURRENDER) != 0,
+        logged->naturalPays, logged->naturalPer };
+    for (const TableRules* named : RULE_VARIANTS)
+    {
+        if (named->decks == rules.decks && named->hitSoft17 == rules.hitSoft17 && named->doubleAfterSplit == rules.doubleAfterSplit
+            && named->lateSurrender == rules.lateSurrender && named->naturalPays == rules.naturalPays && named->naturalPer == rules.naturalPer)
+        {
+            return *named;
+        }
+    }
+    return rules;
+} // end of loggedRules
+
+//---------------------------------describe-------------------------------------
+//Description: Private function that returns an event as text, for reporting
+//             where a replay parts from the log.
+//Parameters:  - event: The event.
+//------------------------------------------------------------------------------
+string Replay::describe(const HistoryEvent &event)
+{
+    int action = (int) event.action;
+    string text = action < (int) (sizeof(HISTORY_ACTIONS) / sizeof(HISTORY_ACTIONS[0])) ? HISTORY_ACTIONS[action] : "?";
+    text += event.seat == HISTORY_DEALER ? " dealer" : " seat " + to_string(event.seat);
+    text += " hand " + to_string(event.hand);
+    if (event.card != HISTORY_NO_CARD)
+    {
+        text += " " + decodeCard(event.card);
+    }
+    return text + " amount " + to_string(event.amount);
+} // end of describe
@@ -0,0 +1,54 @@
+//----------------------------------Replay.h------------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the header file for the Replay class used by the hand
+//             history tool. A Replay plays a table again, headless and as fast
+//             as it can, from its records in the log: a Game is built with the
+//             rules and shoe seed the first round was logged with, players sit
+//             down at the seats and with the balances logged, and every bet and
+//             action goes to the Game in the order it was logged. The Game
+//             deals and settles on its own, and records each round as the
+//             server did; its record is checked against the logged one, every
+//             card, bet and settlement of it, so the first place the replay
+//             parts from the log is reported. The table's records have to run
+//             from its first round on with none dropped, as a round's shoe
+//             follows from every round before it.
+//------------------------------------------------------------------------------
+#ifndef REPLAY_H
+#define REPLAY_H
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include "MappedFile.h"
+#include "HistoryIndex.h"
+#include "Game.h"
+using namespace std;
+
+class Replay
+{
+    private:
+        const MappedFile &log;              //The hand history log
+        const HistoryIndex &index;          //The log's index
+        uint32_t table;                     //Game ID of the table played again
+        string seated[HISTORY_SEATS];       //Name at each seat of the replayed table, empty if nobody sits there
+        long long rounds;                   //Rounds replayed and found the same as logged
+        long long events;                   //Events in those rounds
+        string failure;                     //Why the last run stopped, empty if it didn't
+        bool replayRound(Game &game, const HistoryHeader* logged);
+        bool compare(const HistoryHeader* logged, const HistoryHeader* replayed);
+        bool fail(const HistoryHeader* logged, const char* reason, const string &detail = "");
+        static TableRules loggedRules(const HistoryHeader* logged);
+        static string describe(const HistoryEvent &event);
+
+    public:
+        //Constructors
+        Replay(const MappedFile &log, const HistoryIndex &index, uint32_t table);
+        //Getters
+        long long getRounds() const;
+        long long getEvents() const;
+        const string &getFailure() const;
+
+        //Setters
+        bool run();
+};
+#endif
@@ -0,0 +1,3 @@
+#!/usr/bin/env bash
+SERVER="HandHistory Ledger Snapshot card Game Deck Player Seat Arena Renderer PlayerPool CardCounter Composition Random"
+g++ -std=c++14 -O2 -pthread -Wall -Wextra -w -I../Server *.cpp $(for f in $SERVER; do echo ../Server/$f.cpp; done) -o history
@@ -0,0 +1,114 @@
+//---------------------------------Arena.cpp------------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the implementation file for the Arena class. It hands out
+//             memory for the objects that only live for one round of a table,
+//             such as the Cards dealt, by bumping an offset through blocks it
+//             keeps for the life of the table. Nothing is freed one object at a
+//             time; reset rewinds to the first block when the round is settled,
+//             so a table that has played a round or two never calls the global
+//             allocator for them again, and tables on different threads never
+//             contend for it. Objects made with create are destroyed with
+//             destroy before the reset. The class is used within Game and is
+//             created by the Game class.
+//------------------------------------------------------------------------------
+#include "Arena.h"
+
+//-----------------------------------Arena--------------------------------------
+//Description: Constructor for Arena. The first block is made on first use.
+//Parameters:  - blockSize: Bytes in each block.
+//------------------------------------------------------------------------------
+Arena::Arena(size_t blockSize)
+{
+    this->blockSize = blockSize;
+    this->current = 0;
+    this->offset = 0;
+    this->used = 0;
+} // end of Arena
+
+//-----------------------------------~Arena-------------------------------------
+//Description: Destructor for Arena. Frees every block.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+Arena::~Arena()
+{
+    for (size_t i = 0; i < this->blocks.size(); i++)
+    {
+        delete[] this->blocks[i];
+    }
+} // end of ~Arena
+
+//----------------------------------getUsed-------------------------------------
+//Description: Public function that returns the bytes handed out since the
+//             last reset, padding included.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+size_t Arena::getUsed() const
+{
+    return this->used;
+} // end of getUsed
+
+//--------------------------------getCapacity-----------------------------------
+//Description: Public function that returns the bytes held in every block.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+size_t Arena::getCapacity() const
+{
+    size_t capacity = 0;
+    for (size_t i = 0; i < this->sizes.size(); i++)
+    {
+        capacity += this->sizes[i];
+    }
+    return capacity;
+} // end of getCapacity
+
+//--------------------------------getNumBlocks----------------------------------
+//Description: Public function that returns the number of blocks held.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+int Arena::getNumBlocks() const
+{
+    return this->blocks.size();
+} // end of getNumBlocks
+
+//----------------------------------allocate------------------------------------
+//Description: Public function that returns memory for an object, from the
+//             current block if it fits, else from the next block kept from an
+//             earlier round, else from a new block big enough for it.
+//Parameters:  - bytes:     Size of the object.
+//             - alignment: Alignment of the object, a power of two.
+//------------------------------------------------------------------------------
+void* Arena::allocate(size_t bytes, size_t alignment)
+{
+    while (this->current < this->blocks.size())
+    {
+        size_t start = (this->offset + alignment - 1) & ~(alignment - 1);
+        if (start + bytes <= this->sizes[this->current])
+        {
+            this->used += start + bytes - this->offset;
+            this->offset = start + bytes;
+            return this->blocks[this->current] + start;
+        }
+        this->current++;
+        this->offset = 0;
+    }
+    size_t size = max(this->blockSize, bytes + alignment);
+    this->blocks.push_back(new char[size]);
+    this->sizes.push_back(size);
+    this->current = this->blocks.size() - 1;
+    this->offset = 0;
+    return allocate(bytes, alignment);
+} // end of allocate
+
+//-----------------------------------reset--------------------------------------
+//Description: Public function that takes back everything handed out, keeping
+//             the blocks for the next round. Objects still in the Arena must
+//             have been destroyed.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+void Arena::reset()
+{
+    this->current = 0;
+    this->offset = 0;
+    this->used = 0;
+} // end of reset
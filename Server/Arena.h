@@ -0,0 +1,77 @@
+//----------------------------------Arena.h-------------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the header file for the Arena class. It hands out memory
+//             for the objects that only live for one round of a table, such as
+//             the Cards dealt, by bumping an offset through blocks it keeps for
+//             the life of the table. Nothing is freed one object at a time;
+//             reset rewinds to the first block when the round is settled, so a
+//             table that has played a round or two never calls the global
+//             allocator for them again, and tables on different threads never
+//             contend for it. Objects made with create are destroyed with
+//             destroy before the reset. The class is used within Game and is
+//             created by the Game class.
+//------------------------------------------------------------------------------
+#ifndef ARENA_H
+#define ARENA_H
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <algorithm>
+#include <vector>
+using namespace std;
+
+static const size_t ARENA_BLOCK_SIZE = 16384;   //Bytes in each block, enough for a full table's round
+
+class Arena
+{
+    private:
+        vector<char*> blocks;       //Blocks kept for the life of the Arena
+        vector<size_t> sizes;       //Bytes in each block
+        size_t blockSize;           //Bytes in each new block
+        size_t current;             //Index of the block being handed out
+        size_t offset;              //Bytes handed out from the current block
+        size_t used;                //Bytes handed out since the last reset
+
+    public:
+        //Constructors
+        Arena(size_t blockSize = ARENA_BLOCK_SIZE);
+        Arena(const Arena &arena) = delete;
+        Arena &operator=(const Arena &arena) = delete;
+        ~Arena();
+        //Getters
+        size_t getUsed() const;
+        size_t getCapacity() const;
+        int getNumBlocks() const;
+
+        //Setters
+        void* allocate(size_t bytes, size_t alignment);
+        void reset();
+        template <typename T, typename... Args>
+        T* create(Args&&... args);
+        template <typename T>
+        void destroy(T* object);
+};
+
+//-----------------------------------create-------------------------------------
+//Description: Public function that constructs an object in the Arena. It lives
+//             until it is destroyed, at the latest before the next reset.
+//Parameters:  - args: Arguments passed on to the object's constructor.
+//------------------------------------------------------------------------------
+template <typename T, typename... Args>
+T* Arena::create(Args&&... args)
+{
+    return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+} // end of create
+
+//-----------------------------------destroy------------------------------------
+//Description: Public function that runs an object's destructor. Its memory is
+//             only given back when the Arena is reset.
+//Parameters:  - object: Object made by create.
+//------------------------------------------------------------------------------
+template <typename T>
+void Arena::destroy(T* object)
+{
+    object->~T();
+} // end of destroy
+#endif
@@ -0,0 +1,135 @@
+//-------------------------------BasicStrategy.h--------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the basic strategy chart for Game's rules with 4 decks,
+//             generated by ./simulator --basic-strategy from the exact
+//             expected values of every two card hand. Do not edit it by
+//             hand. It is indexed [soft][firstAction][points][upcard], with
+//             a soft Ace counted in points, so a decision is one lookup.
+//             S stands, H hits, D doubles down and R surrenders.
+//------------------------------------------------------------------------------
+#ifndef BASICSTRATEGY_H
+#define BASICSTRATEGY_H
+#include "Rules.h"
+
+namespace Basic
+{
+    static constexpr Decision S = Decision::STAND, H = Decision::HIT,
+                              D = Decision::DOUBLE_DOWN, R = Decision::SURRENDER;
+
+    static constexpr Decision CHART[2][2][BLACKJACK + 1][NUM_RANKS + 1] =
+    {
+        { //Hard totals
+            { //After a hit
+                //     -  A  2  3  4  5  6  7  8  9  10
+                /* 0*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /* 1*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /* 2*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /* 3*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /* 4*/ {S, H, H, H, H, H, H, H, H, H, H},
+                /* 5*/ {S, H, H, H, H, H, H, H, H, H, H},
+                /* 6*/ {S, H, H, H, H, H, H, H, H, H, H},
+                /* 7*/ {S, H, H, H, H, H, H, H, H, H, H},
+                /* 8*/ {S, H, H, H, H, H, H, H, H, H, H},
+                /* 9*/ {S, H, H, H, H, H, H, H, H, H, H},
+                /*10*/ {S, H, H, H, H, H, H, H, H, H, H},
+                /*11*/ {S, H, H, H, H, H, H, H, H, H, H},
+                /*12*/ {S, H, H, H, S, S, S, H, H, H, H},
+                /*13*/ {S, R, S, S, S, S, S, H, H, H, H},
+                /*14*/ {S, R, S, S, S, S, S, H, H, H, H},
+                /*15*/ {S, R, S, S, S, S, S, H, H, H, R},
+                /*16*/ {S, R, S, S, S, S, S, H, H, R, R},
+                /*17*/ {S, R, S, S, S, S, S, S, S, S, S},
+                /*18*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /*19*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /*20*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /*21*/ {S, S, S, S, S, S, S, S, S, S, S}
+            },
+            { //First action
+                //     -  A  2  3  4  5  6  7  8  9  10
+                /* 0*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /* 1*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /* 2*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /* 3*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /* 4*/ {S, H, H, H, H, H, H, H, H, H, H},
+                /* 5*/ {S, H, H, H, H, H, H, H, H, H, H},
+                /* 6*/ {S, H, H, H, H, H, H, H, H, H, H},
+                /* 7*/ {S, H, H, H, H, H, H, H, H, H, H},
+                /* 8*/ {S, H, H, H, H, H, H, H, H, H, H},
+                /* 9*/ {S, H, H, D, D, D, D, H, H, H, H},
+                /*10*/ {S, H, D, D, D, D, D, D, D, D, H},
+                /*11*/ {S, H, D, D, D, D, D, D, D, D, H},
+                /*12*/ {S, H, H, H, S, S, S, H, H, H, H},
+                /*13*/ {S, R, S, S, S, S, S, H, H, H, H},
+                /*14*/ {S, R, S, S, S, S, S, H, H, H, H},
+                /*15*/ {S, R, S, S, S, S, S, H, H, H, R},
+                /*16*/ {S, R, S, S, S, S, S, H, H, R, R},
+                /*17*/ {S, R, S, S, S, S, S, S, S, S, S},
+                /*18*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /*19*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /*20*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /*21*/ {S, S, S, S, S, S, S, S, S, S, S}
+            }
+        },
+        { //Soft totals
+            { //After a hit
+                //     -  A  2  3  4  5  6  7  8  9  10
+                /* 0*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /* 1*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /* 2*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /* 3*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /* 4*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /* 5*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /* 6*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /* 7*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /* 8*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /* 9*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /*10*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /*11*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /*12*/ {S, H, H, H, H, H, H, H, H, H, H},
+                /*13*/ {S, H, H, H, H, H, H, H, H, H, H},
+                /*14*/ {S, H, H, H, H, H, H, H, H, H, H},
+                /*15*/ {S, H, H, H, H, H, H, H, H, H, H},
+                /*16*/ {S, H, H, H, H, H, H, H, H, H, H},
+                /*17*/ {S, H, H, H, H, H, H, H, H, H, H},
+                /*18*/ {S, H, S, S, S, S, S, S, S, H, H},
+                /*19*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /*20*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /*21*/ {S, S, S, S, S, S, S, S, S, S, S}
+            },
+            { //First action
+                //     -  A  2  3  4  5  6  7  8  9  10
+                /* 0*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /* 1*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /* 2*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /* 3*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /* 4*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /* 5*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /* 6*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /* 7*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /* 8*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /* 9*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /*10*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /*11*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /*12*/ {S, H, H, H, H, H, D, H, H, H, H},
+                /*13*/ {S, H, H, H, H, D, D, H, H, H, H},
+                /*14*/ {S, H, H, H, H, D, D, H, H, H, H},
+                /*15*/ {S, H, H, H, D, D, D, H, H, H, H},
+                /*16*/ {S, H, H, H, D, D, D, H, H, H, H},
+                /*17*/ {S, H, H, D, D, D, D, H, H, H, H},
+                /*18*/ {S, H, S, D, D, D, D, S, S, H, H},
+                /*19*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /*20*/ {S, S, S, S, S, S, S, S, S, S, S},
+                /*21*/ {S, S, S, S, S, S, S, S, S, S, S}
+            }
+        }
+    };
+}
+
+//Returns the basic strategy action for a hand: points counts a soft Ace as
+//11, and double down is only charted for the first action.
+constexpr Decision basicDecision(int points, bool soft, int upcard, bool firstAction)
+{
+    return Basic::CHART[soft][firstAction][points][upcard];
+}
+#endif
@@ -0,0 +1,213 @@
+/*
+* Broadcast.cpp
+*
+* CSS 432 Group Lucky No 13
+*
+* Fans a table's event stream out to read-only spectators
+*/
+
+#include "Broadcast.h"
+
+/*
+* Fan-out thread writing the ring to every watcher
+*/
+#pragma region Fan-out
+
+void* Broadcast::fanOut(void* arg) {
+
+	Broadcast* broadcast = (Broadcast*) arg;
+	bool behind{false};
+
+	while (true) {
+		broadcast->sleep(behind);
+
+		lock(&broadcast->mtx);
+		bool stopped = broadcast->stopped;
+		unlock(&broadcast->mtx);
+
+		if (stopped) {
+			break;
+		}
+		behind = broadcast->sendAll();
+	}
+	pthread_exit(nullptr);
+}
+
+/*
+* Send as much of the pending stream as the watcher's socket will
+* take without blocking, return false if the watcher should be dropped
+*/
+bool Broadcast::send(Watcher* watcher, unsigned long long end) const {
+
+	while (watcher->sent < end) {
+
+		ssize_t bytes = ::send(watcher->sock, pending + (watcher->sent - copied), end - watcher->sent, MSG_DONTWAIT | MSG_NOSIGNAL);
+
+		if (bytes < 0) {
+			return errno == EAGAIN || errno == EWOULDBLOCK;
+		}
+		watcher->sent += bytes;
+	}
+	return true;
+}
+
+/*
+* Send pending stream to all watchers, drop those that fell
+* a full ring behind or disconnected, return true if any are still behind
+*/
+bool Broadcast::sendAll() {
+
+	lock(&mtx);
+	unsigned long long end = head;
+	sending.assign(watchers.begin(), watchers.end());
+
+	// Copy from the furthest behind watcher still within a full ring
+	copied = end;
+	for (const auto& watcher : sending) {
+		if (end - watcher.sent <= Size::RING) {
+			copied = std::min(copied, watcher.sent);
+		}
+	}
+	int offset = copied % Size::RING;
+	int sz = end - copied;
+	int first = std::min(sz, Size::RING - offset);
+	memcpy(pending, ring + offset, first);
+	memcpy(pending + first, ring, sz - first);
+	unlock(&mtx);
+
+	// Sends happen outside the lock so publish() never waits on a socket
+	for (auto& watcher : sending) {
+		if (end - watcher.sent > Size::RING || !send(&watcher, end)) {
+			watcher.sock = Tcp::NO_FD;
+		}
+	}
+
+	lock(&mtx);
+	// Anything older than a full ring is gone, the watcher can't catch up
+	unsigned long long oldest = head > Size::RING ? head - Size::RING : 0;
+	bool behind{false};
+	size_t kept{0};
+	for (size_t i = 0; i < watchers.size(); i++) {
+		if (i < sending.size()) {
+			if (sending[i].sock == Tcp::NO_FD || watchers[i].sent < oldest) {
+				close(watchers[i].sock);
+				continue;
+			}
+			watchers[i].sent = sending[i].sent;
+		}
+		behind = behind || watchers[i].sent < head;
+		watchers[kept++] = watchers[i];
+	}
+	watchers.resize(kept);
+	unlock(&mtx);
+
+	return behind;
+}
+
+/*
+* Sleep until more is published or a retry is due
+*/
+void Broadcast::sleep(bool behind) {
+
+	lock(&mtx);
+	if (behind) {
+		timeval now;
+		gettime(&now);
+		long nsec = now.tv_usec * 1000L + Default::WATCH_RETRY_MS * 1000000L;
+		timespec until{ now.tv_sec + nsec / 1000000000L, nsec % 1000000000L };
+		pthread_cond_timedwait(&published, &mtx, &until);
+	}
+	else {
+		bool current{true};
+		for (const auto& watcher : watchers) {
+			current = current && watcher.sent == head;
+		}
+		while (current && !stopped) {
+			pthread_cond_wait(&published, &mtx);
+			current = false;
+		}
+	}
+	unlock(&mtx);
+}
+
+#pragma endregion
+
+/*
+* Publishing events and attaching watchers
+*/
+#pragma region Publish, Watch
+
+void Broadcast::publish(const char msg[], int sz) {
+
+	if (sz > Size::RING) {
+		msg += sz - Size::RING;
+		sz = Size::RING;
+	}
+
+	lock(&mtx);
+	int offset = head % Size::RING;
+	int first = std::min(sz, Size::RING - offset);
+	memcpy(ring + offset, msg, first);
+	memcpy(ring, msg + first, sz - first);
+	head += sz;
+	pthread_cond_signal(&published);
+	unlock(&mtx);
+}
+bool Broadcast::addWatcher(int sock) {
+
+	lock(&mtx);
+	bool added = watchers.size() + joining < Default::MAX_WATCHERS;
+	joining += added;
+	unlock(&mtx);
+
+	if (!added) {
+		return false;
+	}
+
+	// Told outside the lock so publish() never waits on the socket
+	writeTo(sock, true);
+	lock(&mtx);
+	joining--;
+	watchers.push_back({ sock, head });
+	unlock(&mtx);
+	return true;
+}
+int Broadcast::watcherCount() const {
+	lock(&mtx);
+	int count = watchers.size();
+	unlock(&mtx);
+	return count;
+}
+
+#pragma endregion
+
+/*
+* Start the fan-out thread, stop it and close every watcher
+*/
+#pragma region Constructor, Destructor
+
+Broadcast::Broadcast() :head{0}, joining{0}, copied{0}, stopped{false} {
+	init(&mtx);
+	if (pthread_cond_init(&published, nullptr) != 0) {
+		perror(Failure::COND);
+	}
+	if (pthread_create(&thread, nullptr, fanOut, this) != 0) {
+		perror(Failure::CREATE);
+	}
+}
+Broadcast::~Broadcast() {
+
+	lock(&mtx);
+	stopped = true;
+	pthread_cond_signal(&published);
+	unlock(&mtx);
+
+	pthread_join(thread, nullptr);
+	for (const auto& watcher : watchers) {
+		close(watcher.sock);
+	}
+	pthread_cond_destroy(&published);
+	pthread_mutex_destroy(&mtx);
+}
+
+#pragma endregion
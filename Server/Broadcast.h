@@ -0,0 +1,123 @@
+/*
+* Broadcast.h
+*
+* CSS 432 Group Lucky No 13
+*
+* Fans a table's event stream out to read-only spectators
+*/
+
+#ifndef BROADCAST_H
+#define BROADCAST_H
+
+#include <vector>
+#include <algorithm>
+#include <errno.h>
+#include <sys/socket.h>
+#include "Utilities.h"
+
+
+class Broadcast {
+
+	/*
+	* Spectator's socket and how far into the stream they have been sent
+	*/
+	struct Watcher {
+		int sock;
+		unsigned long long sent;
+	};
+
+	/*
+	* Mutex for the ring and watchers,
+	* condition for the fan-out thread to sleep on
+	*/
+	mutable pthread_mutex_t mtx;
+	pthread_cond_t published;
+
+	/*
+	* Every event is copied once into the ring,
+	* head is the total number of bytes ever published
+	*/
+	char ring[Size::RING];
+	unsigned long long head;
+
+	/*
+	* Spectators attached to the table
+	*/
+	std::vector<Watcher> watchers;
+
+	/*
+	* Watchers being told they are attached, holding their seat
+	*/
+	int joining;
+
+	/*
+	* Fan-out thread's copy of the watchers while sending unlocked
+	*/
+	std::vector<Watcher> sending;
+
+	/*
+	* Fan-out thread's copy of the stream still to be sent, taken under
+	* the lock so publish() never overwrites bytes mid-send,
+	* copied is the stream position of its first byte
+	*/
+	char pending[Size::RING];
+	unsigned long long copied;
+
+	/*
+	* Fan-out thread and its stop signal
+	*/
+	pthread_t thread;
+	bool stopped;
+
+	/*
+	* Fan-out thread writing the ring to every watcher
+	*/
+	static void* fanOut(void*);
+
+	/*
+	* Send as much of the pending stream as the watcher's socket will
+	* take without blocking, return false if the watcher should be dropped
+	*/
+	bool send(Watcher*, unsigned long long end) const;
+
+	/*
+	* Send pending stream to all watchers, drop those that fell
+	* a full ring behind or disconnected, return true if any are still behind
+	*/
+	bool sendAll();
+
+	/*
+	* Sleep until more is published or a retry is due
+	*/
+	void sleep(bool behind);
+
+public:
+
+	/*
+	* Start the fan-out thread
+	*/
+	Broadcast();
+
+	/*
+	* Stop the fan-out thread and close every watcher's socket
+	*/
+	~Broadcast();
+
+	/*
+	* Copy the event into the ring and wake the fan-out thread,
+	* never waits on a watcher
+	*/
+	void publish(const char msg[], int sz);
+
+	/*
+	* Attach a spectator at the live end of the stream,
+	* return false if the table already has the maximum watchers
+	*/
+	bool addWatcher(int sock);
+
+	/*
+	* Return the amount of watchers
+	*/
+	int watcherCount() const;
+};
+#endif
@@ -0,0 +1,99 @@
+//------------------------------CardCounter.cpp---------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the implementation file for the CardCounter class. It
+//             adds the tag of each card as it is seen, so the running count and
+//             the true count are always ready in O(1).
+//------------------------------------------------------------------------------
+#include "CardCounter.h"
+
+//--------------------------------CardCounter-----------------------------------
+//Description: Constructor for a CardCounter at the start of a full shoe.
+//Parameters:  - system:   Counting system to use.
+//             - numDecks: Number of decks in a full shoe.
+//------------------------------------------------------------------------------
+CardCounter::CardCounter(const CountingSystem &system, const int numDecks)
+{
+    this->system = &system;
+    reset(numDecks);
+} // end of CardCounter
+
+//---------------------------------getSystem------------------------------------
+//Description: Returns the counting system in use.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+const CountingSystem &CardCounter::getSystem() const
+{
+    return *this->system;
+} // end of getSystem
+
+//------------------------------getRunningCount---------------------------------
+//Description: Returns the running count.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+int CardCounter::getRunningCount() const
+{
+    return this->runningCount;
+} // end of getRunningCount
+
+//-------------------------------getTrueCount-----------------------------------
+//Description: Returns the running count per deck left to be dealt. Unbalanced
+//             systems such as KO are meant to be read from the running count
+//             alone, but the ratio is still returned for them.
+//Parameters:  - cardsLeft: Cards not yet seen.
+//------------------------------------------------------------------------------
+double CardCounter::getTrueCount(int cardsLeft) const
+{
+    if (cardsLeft <= 0)
+    {
+        return this->runningCount;
+    }
+    return this->runningCount * (double) CARDS_PER_DECK / cardsLeft;
+} // end of getTrueCount
+
+//---------------------------------setSystem------------------------------------
+//Description: Switches to another counting system mid-shoe, recounting the
+//             cards already seen from the ones that are left.
+//Parameters:  - system: Counting system to use from now on.
+//             - unseen: Cards not yet seen.
+//------------------------------------------------------------------------------
+void CardCounter::setSystem(const CountingSystem &system, const Composition &unseen)
+{
+    this->system = &system;
+    recount(this->numDecks, unseen);
+} // end of setSystem
+
+//----------------------------------addCard-------------------------------------
+//Description: Adds the tag of a card that has just been seen.
+//Parameters:  - rank: Rank of the card.
+//------------------------------------------------------------------------------
+void CardCounter::addCard(int rank)
+{
+    this->runningCount += this->system->tags[rank];
+} // end of addCard
+
+//-----------------------------------reset--------------------------------------
+//Description: Starts the count over for a fresh shoe.
+//Parameters:  - numDecks: Number of decks in the new shoe.
+//------------------------------------------------------------------------------
+void CardCounter::reset(const int numDecks)
+{
+    this->numDecks = numDecks;
+    this->runningCount = this->system->startPerDeck * numDecks + this->system->startOffset;
+} // end of reset
+
+//----------------------------------recount-------------------------------------
+//Description: Sets the running count from the cards not yet seen, for when the
+//             shoe changes other than by a card being seen.
+//Parameters:  - numDecks: Number of decks in the shoe.
+//             - unseen:   Cards not yet seen.
+//------------------------------------------------------------------------------
+void CardCounter::recount(const int numDecks, const Composition &unseen)
+{
+    reset(numDecks);
+    Composition full(numDecks);
+    for (int rank = ACE; rank <= NUM_RANKS; rank++)
+    {
+        this->runningCount += this->system->tags[rank] * (full.getCount(rank) - unseen.getCount(rank));
+    }
+} // end of recount
@@ -0,0 +1,51 @@
+//-------------------------------CardCounter.h----------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the header file for the CardCounter class and the
+//             CountingSystem struct. A CountingSystem gives every rank a tag and
+//             says where the running count starts; HI_LO, KO and HI_OPT_I are
+//             provided. A CardCounter adds the tag of each card as it is seen,
+//             so the running count and the true count (running count per deck
+//             left) are always ready in O(1). It is used by Deck and the
+//             simulator's Shoe.
+//------------------------------------------------------------------------------
+#ifndef CARDCOUNTER_H
+#define CARDCOUNTER_H
+#include "Rules.h"
+#include "Composition.h"
+using namespace std;
+
+struct CountingSystem
+{
+    const char* name;               //Name of the system
+    int tags[NUM_RANKS + 1];        //Tag added for each rank seen (index 0 unused)
+    int startPerDeck;               //Running count at the start, per deck in the shoe
+    int startOffset;                //Added to the start once, for unbalanced counts
+};
+
+//                                     -   A   2   3   4   5   6   7   8   9   10
+static const CountingSystem HI_LO    = {"hilo",   {0, -1,  1,  1,  1,  1,  1,  0,  0,  0, -1},  0, 0};
+static const CountingSystem KO       = {"ko",     {0, -1,  1,  1,  1,  1,  1,  1,  0,  0, -1}, -4, 4};
+static const CountingSystem HI_OPT_I = {"hiopt1", {0,  0,  0,  1,  1,  1,  1,  0,  0,  0, -1},  0, 0};
+
+class CardCounter
+{
+    private:
+        const CountingSystem* system;   //Tags and starting count in use
+        int numDecks;                   //Number of decks in a full shoe
+        int runningCount;               //Start plus the tags of every card seen
+
+    public:
+        //Constructors
+        CardCounter(const CountingSystem &system, const int numDecks);
+        //Getters
+        const CountingSystem &getSystem() const;
+        int getRunningCount() const;
+        double getTrueCount(int cardsLeft) const;
+        //Setters
+        void setSystem(const CountingSystem &system, const Composition &unseen);
+        void addCard(int rank);
+        void reset(const int numDecks);
+        void recount(const int numDecks, const Composition &unseen);
+};
+#endif
@@ -0,0 +1,132 @@
+//------------------------------Composition.cpp---------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the implementation file for the Composition class. It
+//             contains the number of cards of each rank (Ace through Ten) left
+//             in a shoe and the total number of cards left as private members,
+//             and exposes functions to read and adjust those counts. The
+//             CompositionKey class encodes a Composition, together with a small
+//             state number, as one 64 bit mixed radix key for memoization.
+//------------------------------------------------------------------------------
+#include "Composition.h"
+#include <cassert>
+
+//--------------------------------Composition-----------------------------------
+//Description: Default (empty) constructor for a Composition.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+Composition::Composition()
+{
+    for (int rank = 0; rank <= NUM_RANKS; rank++)
+    {
+        this->counts[rank] = 0;
+    }
+    this->total = 0;
+} // end of Composition
+
+//--------------------------------Composition-----------------------------------
+//Description: Constructor for the Composition of a full shoe.
+//Parameters:  - numDecks: Number of decks in the shoe.
+//------------------------------------------------------------------------------
+Composition::Composition(const int numDecks) : Composition()
+{
+    for (int rank = ACE; rank < TEN; rank++)
+    {
+        this->counts[rank] = numDecks * SUITS_PER_DECK;
+    }
+    this->counts[TEN] = numDecks * SUITS_PER_DECK * 4; //10, J, Q and K
+    this->total = numDecks * CARDS_PER_DECK;
+} // end of Composition
+
+//---------------------------------getCount-------------------------------------
+//Description: Returns the number of cards of the given rank left.
+//Parameters:  - rank: Rank of the card, 1 (Ace) through 10.
+//------------------------------------------------------------------------------
+int Composition::getCount(int rank) const
+{
+    return this->counts[rank];
+} // end of getCount
+
+//---------------------------------getTotal-------------------------------------
+//Description: Returns the number of cards left.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+int Composition::getTotal() const
+{
+    return this->total;
+} // end of getTotal
+
+//------------------------------getProbability----------------------------------
+//Description: Returns the probability that the next card is the given rank.
+//Parameters:  - rank: Rank of the card, 1 (Ace) through 10.
+//------------------------------------------------------------------------------
+double Composition::getProbability(int rank) const
+{
+    if (this->total == 0)
+    {
+        return 0;
+    }
+    return (double) this->counts[rank] / this->total;
+} // end of getProbability
+
+//--------------------------------removeCard------------------------------------
+//Description: Removes a card of the given rank. Returns false if none are left.
+//Parameters:  - rank: Rank of the card, 1 (Ace) through 10.
+//------------------------------------------------------------------------------
+bool Composition::removeCard(int rank)
+{
+    if (this->counts[rank] == 0)
+    {
+        return false;
+    }
+    this->counts[rank]--;
+    this->total--;
+    return true;
+} // end of removeCard
+
+//---------------------------------addCard--------------------------------------
+//Description: Puts a card of the given rank back.
+//Parameters:  - rank: Rank of the card, 1 (Ace) through 10.
+//------------------------------------------------------------------------------
+void Composition::addCard(int rank)
+{
+    this->counts[rank]++;
+    this->total++;
+} // end of addCard
+
+//-------------------------------CompositionKey---------------------------------
+//Description: Constructor for a CompositionKey. Sets up the place value of
+//             every rank's count for a shoe of the given size, above the state
+//             number in the lowest place. numDecks and numStates must keep the
+//             product of the places under 2^64 (8 decks leaves room for about
+//             1000 states).
+//Parameters:  - numDecks:  Number of decks in the full shoe.
+//             - numStates: Number of state values encoded below the counts.
+//------------------------------------------------------------------------------
+CompositionKey::CompositionKey(const int numDecks, const int numStates)
+{
+    Composition full(numDecks);
+    unsigned long long place = numStates;
+    for (int rank = ACE; rank <= NUM_RANKS; rank++)
+    {
+        this->radix[rank] = place;
+        this->limit[rank] = full.getCount(rank);
+        place *= full.getCount(rank) + 1;
+    }
+} // end of CompositionKey
+
+//-----------------------------------encode-------------------------------------
+//Description: Returns the key for the Composition and state.
+//Parameters:  - shoe:  Cards left in the shoe.
+//             - state: State number, 0 to numStates - 1.
+//------------------------------------------------------------------------------
+unsigned long long CompositionKey::encode(const Composition &shoe, int state) const
+{
+    unsigned long long key = state;
+    for (int rank = ACE; rank <= NUM_RANKS; rank++)
+    {
+        assert(shoe.getCount(rank) <= this->limit[rank]); //A bigger shoe than the key was built for
+        key += shoe.getCount(rank) * this->radix[rank];
+    }
+    return key;
+} // end of encode
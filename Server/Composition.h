@@ -0,0 +1,49 @@
+//-------------------------------Composition.h----------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the header file for the Composition class. It contains
+//             the number of cards of each rank (Ace through Ten) left in a shoe
+//             and the total number of cards left as private members, and
+//             exposes functions to read and adjust those counts. It is the
+//             input to the exact probability and expected value calculators,
+//             which need to know what the shoe holds but not its order. The
+//             CompositionKey class encodes a Composition, together with a small
+//             state number, as one 64 bit mixed radix key for memoization.
+//------------------------------------------------------------------------------
+#ifndef COMPOSITION_H
+#define COMPOSITION_H
+#include "Rules.h"
+using namespace std;
+
+class Composition
+{
+    private:
+        int counts[NUM_RANKS + 1];  //Cards left of each rank, indexed by rank (index 0 unused)
+        int total;                  //Cards left in all
+
+    public:
+        //Constructors
+        Composition();
+        Composition(const int numDecks);
+        //Getters
+        int getCount(int rank) const;
+        int getTotal() const;
+        double getProbability(int rank) const;
+        //Setters
+        bool removeCard(int rank);
+        void addCard(int rank);
+};
+
+class CompositionKey
+{
+    private:
+        unsigned long long radix[NUM_RANKS + 1];    //Place value of each rank's count in a key
+        int limit[NUM_RANKS + 1];                   //Most cards of each rank a key can hold
+
+    public:
+        //Constructors
+        CompositionKey(const int numDecks, const int numStates);
+        //Getters
+        unsigned long long encode(const Composition &shoe, int state) const;
+};
+#endif
@@ -0,0 +1,143 @@
+//-------------------------------DealerOdds.cpp---------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the implementation file for the DealerOdds class. It
+//             computes the exact probability of the dealer finishing on each
+//             total from 17 to 21 or BUSTing, given the upcard and the
+//             Composition left in the shoe, under the rule in
+//             Game::dealerActions (hit below 17, stand on every 17). Every
+//             subproblem is memoized in a cache keyed by a compact encoding of
+//             the remaining rank counts and the dealer's hand.
+//------------------------------------------------------------------------------
+#include "DealerOdds.h"
+
+//Dealer hand states in a key: hard total 0 to 26, Ace or not, 1, 2 or 3+ cards
+static const int HAND_STATES = (BLACKJACK + TEN + 1) * 2 * 3;
+
+//---------------------------------DealerOdds-----------------------------------
+//Description: Constructor for DealerOdds. Sets up the place value of every
+//             rank's count in the cache key for a shoe of the given size.
+//Parameters:  - numDecks: Number of decks in the shoe, at most MAX_ODDS_DECKS.
+//------------------------------------------------------------------------------
+DealerOdds::DealerOdds(const int numDecks)
+    : keys(numDecks < MAX_ODDS_DECKS ? numDecks : MAX_ODDS_DECKS, HAND_STATES)
+{
+    this->cache.reserve(1 << 16);
+} // end of DealerOdds
+
+//--------------------------------getCacheSize----------------------------------
+//Description: Returns the number of memoized subproblems.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+int DealerOdds::getCacheSize() const
+{
+    return this->cache.size();
+} // end of getCacheSize
+
+//---------------------------------clearCache-----------------------------------
+//Description: Empties the cache, e.g. after a reshuffle.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+void DealerOdds::clearCache()
+{
+    this->cache.clear();
+} // end of clearCache
+
+//------------------------------getProbabilities--------------------------------
+//Description: Returns the dealer's final total probabilities. The shoe must not
+//             include the upcard, which has already been dealt; the hole card
+//             and every hit are drawn from it.
+//Parameters:  - shoe:   Cards left in the shoe.
+//             - upcard: Rank of the dealer's upcard.
+//------------------------------------------------------------------------------
+const DealerProbabilities &DealerOdds::getProbabilities(const Composition &shoe, int upcard)
+{
+    unsigned long long key = getKey(shoe, upcard, upcard == ACE, 1);
+    auto cached = this->cache.find(key);
+    if (cached != this->cache.end())
+    {
+        return cached->second;
+    }
+    if (this->cache.size() >= MAX_CACHE)
+    {
+        clearCache();
+    }
+    Composition remaining(shoe);
+    compute(remaining, upcard, upcard == ACE, 1);
+    return this->cache[key];
+} // end of getProbabilities
+
+//-----------------------------------getKey-------------------------------------
+//Description: Private function that encodes the rank counts and the dealer's
+//             hand as one mixed radix number.
+//Parameters:  - shoe:      Cards left in the shoe.
+//             - hardTotal: Dealer's total with every Ace as 1.
+//             - hasAce:    Whether or not the dealer holds an Ace.
+//             - numCards:  Number of cards the dealer holds.
+//------------------------------------------------------------------------------
+unsigned long long DealerOdds::getKey(const Composition &shoe, int hardTotal, bool hasAce, int numCards) const
+{
+    return this->keys.encode(shoe, (hardTotal * 2 + hasAce) * 3 + (numCards < 3 ? numCards - 1 : 2));
+} // end of getKey
+
+//----------------------------------compute-------------------------------------
+//Description: Private recursive function that returns the final total
+//             probabilities for the dealer's hand, drawing every possible next
+//             card from the shoe while the dealer is below 17. The shoe is
+//             changed while recursing and restored before returning.
+//Parameters:  - shoe:      Cards left in the shoe.
+//             - hardTotal: Dealer's total with every Ace as 1.
+//             - hasAce:    Whether or not the dealer holds an Ace.
+//             - numCards:  Number of cards the dealer holds.
+//------------------------------------------------------------------------------
+DealerProbabilities DealerOdds::compute(Composition &shoe, int hardTotal, bool hasAce, int numCards)
+{
+    DealerProbabilities result = {};
+    int points = hardTotal;
+    if (hasAce && hardTotal + SOFT_BONUS <= BLACKJACK)
+    {
+        points += SOFT_BONUS;
+    }
+    if (hardTotal > BLACKJACK)
+    {
+        result.bust = 1;
+        return result;
+    }
+    if (numCards >= 2 && points >= DEALER_STAND)
+    {
+        result.total[points - DEALER_STAND] = 1;
+        result.natural = numCards == 2 && points == BLACKJACK;
+        return result;
+    }
+
+    unsigned long long key = getKey(shoe, hardTotal, hasAce, numCards);
+    auto cached = this->cache.find(key);
+    if (cached != this->cache.end())
+    {
+        return cached->second;
+    }
+
+    if (shoe.getTotal() == 0) //Game reshuffles long before this; count it as a BUST so the odds sum to 1
+    {
+        result.bust = 1;
+    }
+    for (int rank = ACE; rank <= NUM_RANKS && shoe.getTotal() > 0; rank++)
+    {
+        double chance = shoe.getProbability(rank);
+        if (chance == 0)
+        {
+            continue;
+        }
+        shoe.removeCard(rank);
+        DealerProbabilities next = compute(shoe, hardTotal + rank, hasAce || rank == ACE, numCards + 1);
+        shoe.addCard(rank);
+        for (int i = 0; i < DEALER_TOTALS; i++)
+        {
+            result.total[i] += chance * next.total[i];
+        }
+        result.bust += chance * next.bust;
+        result.natural += chance * next.natural;
+    }
+    this->cache[key] = result;
+    return result;
+} // end of compute
@@ -0,0 +1,48 @@
+//--------------------------------DealerOdds.h----------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the header file for the DealerOdds class. It computes the
+//             exact probability of the dealer finishing on each total from 17 to
+//             21 or BUSTing, given the upcard and the Composition left in the
+//             shoe, under the rule in Game::dealerActions (hit below 17, stand
+//             on every 17). Every subproblem is memoized in a cache keyed by a
+//             compact encoding of the remaining rank counts and the dealer's
+//             hand, so repeated queries over a shoe are answered from the cache.
+//             It is used for strategy and analytics and by the EV calculator.
+//------------------------------------------------------------------------------
+#ifndef DEALERODDS_H
+#define DEALERODDS_H
+#include <unordered_map>
+#include "Rules.h"
+#include "Composition.h"
+using namespace std;
+
+static const int DEALER_TOTALS = BLACKJACK - DEALER_STAND + 1;  //Totals the dealer can stand on
+static const int MAX_CACHE = 1 << 18;   //Entries kept before the cache is cleared
+static const int MAX_ODDS_DECKS = 8;    //Most decks the cache key can encode
+
+struct DealerProbabilities
+{
+    double total[DEALER_TOTALS];    //Chance of standing on 17 + i
+    double bust;                    //Chance of BUSTing
+    double natural;                 //Chance of a two card 21, already counted in total[21 - 17]
+};
+
+class DealerOdds
+{
+    private:
+        unordered_map<unsigned long long, DealerProbabilities> cache;   //Memoized subproblems
+        CompositionKey keys;                                            //Encodes the shoe and dealer hand
+        unsigned long long getKey(const Composition &shoe, int hardTotal, bool hasAce, int numCards) const;
+        DealerProbabilities compute(Composition &shoe, int hardTotal, bool hasAce, int numCards);
+
+    public:
+        //Constructors
+        DealerOdds(const int numDecks);
+        //Getters
+        int getCacheSize() const;
+        //Setters
+        const DealerProbabilities &getProbabilities(const Composition &shoe, int upcard);
+        void clearCache();
+};
+#endif
@@ -3,25 +3,107 @@
 //Team: LuckyNo13
 //Description: This is the header file for the Deck Class. It contains a vector
 //             for temporary storage of Card objects as they are created (cards),
-//             a stack for the Deck of Cards after they are shuffled, the number
-//             of total cards, and a function shuffle the Cards as private members.
+//             a vector used as a stack for the Deck of Cards after they are
+//             shuffled, both holding the Cards by value so a new shoe reuses
+//             their storage instead of allocating every Card, the number
+//             of total cards, the random number generator, the count of each
+//             rank left, a CardCounter keeping the running count of the cards
+//             dealt face up, and a function to shuffle the Cards as private
+//             members.
 //             It exposes functions to retrieve and adjust those attributes. The 
 //             class is used within Game and is created by the Game class.
 //------------------------------------------------------------------------------
 #include "Deck.h"
+#include "HandHistory.h"
+
+static const CountingSystem* const COUNTING_SYSTEMS[] = { &HI_LO, &KO, &HI_OPT_I };
+
+//-----------------------------------getRank------------------------------------
+//Description: Returns the rank of a Card, 1 for an Ace through 10 for a 10 or a
+//             face card.
+//Parameters:  - card: Pointer to a Card.
+//------------------------------------------------------------------------------
+static int getRank(const Card *card)
+{
+  return card->getFace() == "A" ? ACE : card->getValue();
+} // end of getRank
 
 //----------------------------------Deck----------------------------------------
-//Description: Default empty constructor for a Card.
+//Description: Default empty constructor for a Card. Seeds the shuffles from
+//             the clock.
 //------------------------------------------------------------------------------
 Deck::Deck(const int &numDecks)
+  : Deck(numDecks, chrono::system_clock::now().time_since_epoch().count())
+{} // end of Deck()
+
+//----------------------------------Deck----------------------------------------
+//Description: Constructor for a Deck whose shuffles all follow from the given
+//             seed, so the same seed deals the same cards.
+//Parameters:  - numDecks: Number of decks to make.
+//             - seed:     Seed for the random number generator.
+//------------------------------------------------------------------------------
+Deck::Deck(const int &numDecks, unsigned long long seed) : rng(seed), counter(HI_LO, 0)
 {
   this->totalCards = 0;
+  this->numDecks = 0;
+  this->cards.reserve(52);
+  this->deck.reserve(52 * numDecks);
   for (int i = 0; i < numDecks; i++)
   {
     makeDeck();
   }
 } // end of Deck()
 
+//----------------------------------Deck----------------------------------------
+//Description: Constructor for a Deck rebuilt from the image writeImage wrote,
+//             holding the same Cards in the same order with its generator at
+//             the same position. The image is marked bad if it doesn't hold a
+//             Deck.
+//Parameters:  - image: Snapshot image, read up to the end of the Deck's.
+//------------------------------------------------------------------------------
+Deck::Deck(SnapshotReader &image) : counter(HI_LO, 0)
+{
+  this->numDecks = image.get<int32_t>();
+  unsigned long long seed = image.get<uint64_t>();
+  uint128 state = image.get<uint64_t>();
+  state = (state << 64) | image.get<uint64_t>();
+  this->rng = Random(seed);
+  this->rng.setState(state);
+  string systemName = image.getString();
+  for (int rank = ACE; rank <= NUM_RANKS; rank++)
+  {
+    for (int count = image.get<int32_t>(); count > 0 && image.isValid(); count--)
+    {
+      this->hidden.addCard(rank);
+    }
+  }
+  this->totalCards = image.get<int32_t>();
+  image.check(this->numDecks >= 0 && this->totalCards >= 0 && this->totalCards <= this->numDecks * CARDS_PER_DECK);
+  this->cards.reserve(CARDS_PER_DECK);
+  this->deck.reserve(this->totalCards);
+  for (int i = 0; i < this->totalCards && image.isValid(); i++)
+  {
+    uint8_t code = image.get<uint8_t>();
+    if (image.check(code < CARDS_PER_DECK))
+    {
+      this->deck.push_back(restoreCard(code));
+      this->remaining.addCard(getRank(&this->deck.back()));
+    }
+  }
+  this->totalCards = this->deck.size();
+  const CountingSystem* system = nullptr;
+  for (const CountingSystem* known : COUNTING_SYSTEMS)
+  {
+    if (systemName == known->name)
+    {
+      system = known;
+    }
+  }
+  image.check(system != nullptr);
+  this->counter = CardCounter(system != nullptr ? *system : HI_LO, this->numDecks);
+  setCountingSystem(this->counter.getSystem());
+} // end of Deck()
+
 //----------------------------------~Deck---------------------------------------
 //Description: Destructor for a Card.
 //------------------------------------------------------------------------------
@@ -39,29 +121,85 @@ int Deck::getTotalCards() const
   return this->totalCards;
 } // end of getTotalCards
 
+//---------------------------------getSeed--------------------------------------
+//Description: Public function to return the seed the shuffles follow from.
+//Parameters:  - N/A
+//------------------------------------------------------------------------------
+unsigned long long Deck::getSeed() const
+{
+  return this->rng.getSeed();
+} // end of getSeed
+
+//---------------------------------getCount-------------------------------------
+//Description: Public function to return the number of Cards of a rank left in
+//             the Deck.
+//Parameters:  - rank: 1 for an Ace through 10 for a 10 or a face card.
+//------------------------------------------------------------------------------
+int Deck::getCount(int rank) const
+{
+  return this->remaining.getCount(rank);
+} // end of getCount
+
+//------------------------------getComposition----------------------------------
+//Description: Public function to return the count of every rank left in the
+//             Deck.
+//Parameters:  - N/A
+//------------------------------------------------------------------------------
+const Composition &Deck::getComposition() const
+{
+  return this->remaining;
+} // end of getComposition
+
+//------------------------------getRunningCount---------------------------------
+//Description: Public function to return the running count of the Cards dealt
+//             face up since the Deck was made.
+//Parameters:  - N/A
+//------------------------------------------------------------------------------
+int Deck::getRunningCount() const
+{
+  return this->counter.getRunningCount();
+} // end of getRunningCount
+
+//-------------------------------getTrueCount-----------------------------------
+//Description: Public function to return the running count per deck not yet
+//             seen, which includes any Card still face down.
+//Parameters:  - N/A
+//------------------------------------------------------------------------------
+double Deck::getTrueCount() const
+{
+  return this->counter.getTrueCount(this->totalCards + this->hidden.getTotal());
+} // end of getTrueCount
+
 //---------------------------------addCard--------------------------------------
-//Description: Public function to add a Card to the Deck.
-//Parameters:  - newCard: Pointer to a Card.
+//Description: Public function to add a Card to the top of the Deck.
+//Parameters:  - newCard: The Card.
 //------------------------------------------------------------------------------
-bool Deck::addCard(Card *newCard)
+bool Deck::addCard(const Card &newCard)
 {
-  this->deck.push(newCard);
+  this->deck.push_back(newCard);
+  return true;
 } // end of addCard
 
 //--------------------------------drawCard--------------------------------------
-//Description: Public function to return a pointer to a Card from the Deck and 
-//             set whether or not the Card is visible.
+//Description: Public function to return the top Card from the Deck and set
+//             whether or not the Card is visible.
 //Parameters:  - visible: Flag for whether or not the Card is visible.
 //------------------------------------------------------------------------------
-Card* Deck::drawCard(bool visible)
+Card Deck::drawCard(bool visible)
 {
-  Card* copy = this->deck.top();
+  Card copy(this->deck.back());
   if (visible == true)
   {
-    copy->flip();
+    copy.flip();
+    this->counter.addCard(getRank(&copy));
+  }
+  else
+  {
+    this->hidden.addCard(getRank(&copy));
   }
-  this->deck.pop();
+  this->deck.pop_back();
   this->totalCards--;
+  this->remaining.removeCard(getRank(&copy));
   return copy;
 } // end of drawCard
 
@@ -74,14 +212,16 @@ Card* Deck::drawCard(bool visible)
 void Deck::makeDeck()
 {
   this->totalCards += 52;
+  this->numDecks++;
   for (int i = 0; i < 4; i++)
   {
     for (auto itr = cardValues.begin(); itr != cardValues.end(); itr++)
     {
-      Card* newCard = new Card(SUITS[i], itr->first, itr->second);
-      this->cards.push_back(newCard);
+      this->cards.push_back(Card(SUITS[i], itr->first, itr->second));
+      this->remaining.addCard(getRank(&this->cards.back()));
     }
   }
+  this->counter.recount(this->numDecks, this->remaining);
   shuffleDeck();
   while(!this->cards.empty())
   {
@@ -96,32 +236,54 @@ void Deck::makeDeck()
 //------------------------------------------------------------------------------
 void Deck::shuffleDeck()
 {
-  unsigned seed = chrono::system_clock::now().time_since_epoch().count();
-  shuffle(this->cards.begin(), this->cards.end(), default_random_engine(seed));
+  shuffle(this->cards.begin(), this->cards.end(), this->rng);
 } // end of shuffleDeck
 
 //---------------------------------emptyDeck------------------------------------
-//Description: Public function to empty the Deck of all Cards. Also deletes the 
-//             Card objects from memory.
+//Description: Public function to empty the Deck of all Cards, keeping their
+//             storage for the next shoe.
 //Parameters:  - N/A
 //------------------------------------------------------------------------------
 void Deck::emptyDeck()
 {
-  if (!cards.empty())
+  this->cards.clear();
+  this->deck.clear();
+  this->totalCards = 0;
+  this->numDecks = 0;
+  this->remaining = Composition();
+  this->hidden = Composition();
+  this->counter.reset(0);
+} // end of emptyDeck
+
+//--------------------------------revealCard------------------------------------
+//Description: Public function to count a Card that was dealt face down once it
+//             is turned face up.
+//Parameters:  - card: Pointer to the Card that was turned over.
+//------------------------------------------------------------------------------
+void Deck::revealCard(const Card *card)
+{
+  if (this->hidden.removeCard(getRank(card)))
   {
-    for (int i = 0; i < cards.size(); i++)
-    {
-      delete cards[i];
-      cards[i] = nullptr;
-    }
+    this->counter.addCard(getRank(card));
   }
-  while (!deck.empty())
+} // end of revealCard
+
+//----------------------------setCountingSystem---------------------------------
+//Description: Public function to switch the counting system, recounting the
+//             Cards already dealt face up.
+//Parameters:  - system: Counting system to use, e.g. HI_LO or KO.
+//------------------------------------------------------------------------------
+void Deck::setCountingSystem(const CountingSystem &system)
+{
+  Composition unseen(this->remaining);
+  for (int rank = ACE; rank <= NUM_RANKS; rank++)
   {
-    Card* temp = this->deck.top();
-    this->deck.pop();
-    delete temp;
+    for (int i = 0; i < this->hidden.getCount(rank); i++)
+    {
+      unseen.addCard(rank);
+    }
   }
-  this->totalCards = 0;
+  this->counter.setSystem(system, unseen);
 }
 
 //-----------------------------printContents------------------------------------
@@ -131,8 +293,35 @@ void Deck::emptyDeck()
 //------------------------------------------------------------------------------
 void Deck::printContents() const
 {
-  for (int i = 0; i < cards.size(); i++)
+  for (size_t i = 0; i < cards.size(); i++)
   {
-    cout << *cards[i] << " ";
+    cout << cards[i] << " ";
   }
 } // end of printContents
+
+//--------------------------------writeImage------------------------------------
+//Description: Public function that writes the Deck to a snapshot image: the
+//             decks made, the generator's seed and position, the counting
+//             system and the Cards dealt face down, then every Card left from
+//             the bottom of the Deck to its top. The running count follows
+//             from those.
+//Parameters:  - image: Snapshot image to write to.
+//------------------------------------------------------------------------------
+void Deck::writeImage(SnapshotWriter &image) const
+{
+  uint128 state = this->rng.getState();
+  image.put<int32_t>(this->numDecks);
+  image.put<uint64_t>(this->rng.getSeed());
+  image.put<uint64_t>(state >> 64);
+  image.put<uint64_t>(state);
+  image.putString(this->counter.getSystem().name);
+  for (int rank = ACE; rank <= NUM_RANKS; rank++)
+  {
+    image.put<int32_t>(this->hidden.getCount(rank));
+  }
+  image.put<int32_t>(this->deck.size());
+  for (const Card &card : this->deck)
+  {
+    image.put<uint8_t>(encodeCard(card));
+  }
+} // end of writeImage
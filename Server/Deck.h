@@ -3,9 +3,17 @@
 //Team: LuckyNo13
 //Description: This is the header file for the Deck Class. It contains a vector
 //             for temporary storage of Card objects as they are created (cards),
-//             a stack for the Deck of Cards after they are shuffled, the number
-//             of total cards, and a function shuffle the Cards as private members.
-//             It exposes functions to retrieve and adjust those attributes. The 
+//             a vector used as a stack for the Deck of Cards after they are
+//             shuffled, both holding the Cards by value so a new shoe reuses
+//             their storage instead of allocating every Card, the number
+//             of total cards, the random number generator, the count of each
+//             rank left, a CardCounter keeping the running count of the cards
+//             dealt face up, and a function to shuffle the Cards as private
+//             members.
+//             It exposes functions to retrieve and adjust those attributes. A
+//             Deck writes its Cards in order and its generator's position to a
+//             snapshot image and can be rebuilt from one, dealing on exactly as
+//             it would have. The
 //             class is used within Game and is created by the Game class.
 //------------------------------------------------------------------------------
 #ifndef DECK_H
@@ -16,37 +24,56 @@
 #include <vector>
 #include <array>
 #include <map>
-#include <stack>
 #include <random>
 #include <chrono>
 #include <algorithm>
 #include "card.h"
+#include "Random.h"
+#include "Rules.h"
+#include "Composition.h"
+#include "CardCounter.h"
+#include "Snapshot.h"
 using namespace std;
                               //Hearts   Spades    Diamonds  Clubs
 static const string SUITS[] = {"\u2665", "\u2660", "\u2666", "\u2663"};
-static const map<string, int> cardValues = {{"2", 2}, {"3", 3}, {"3", 4},
+static const map<string, int> cardValues = {{"2", 2}, {"3", 3}, {"4", 4},
                         {"5", 5}, {"6", 6}, {"7", 7}, {"8", 8}, {"9", 9},
                         {"10", 10}, {"J", 10}, {"Q", 10}, {"K", 10}, {"A", 11}};
 
 class Deck
 {
   private:
-    vector<Card*> cards;  // Temporary vector to hold cards after being created for shuffling
-    stack<Card*> deck;    // Stack to hold the Deck
+    vector<Card> cards;   // Temporary vector to hold cards after being created for shuffling
+    vector<Card> deck;    // Stack to hold the Deck, top at the back
     int totalCards;       // Total number of Cards in the Deck
+    Random rng;           // Seedable generator used for every shuffle
+    int numDecks;         // Number of decks made since the Deck was last emptied
+    Composition remaining; // Count of each rank left in the Deck
+    CardCounter counter;  // Running count of the Cards dealt face up
+    Composition hidden;   // Count of each rank dealt face down and not yet revealed
     void shuffleDeck();   // Function to shuffle the Deck
 
   public:
     // Constructors
     Deck(const int &);
+    Deck(const int &, unsigned long long seed);
+    Deck(SnapshotReader &image);
     ~Deck();
     // Getters
     int getTotalCards() const;
+    unsigned long long getSeed() const;
+    int getCount(int rank) const;
+    const Composition &getComposition() const;
+    int getRunningCount() const;
+    double getTrueCount() const;
     void printContents() const;
+    void writeImage(SnapshotWriter &image) const;
     // Setters
-    bool addCard(Card *);
-    Card* drawCard(bool visible);
+    bool addCard(const Card &);
+    Card drawCard(bool visible);
     void makeDeck();
     void emptyDeck();
+    void revealCard(const Card *);
+    void setCountingSystem(const CountingSystem &system);
 };
 #endif
@@ -25,13 +25,79 @@ void Driver::addActivePlayer(const PlayerMapping* mapping) {
 */
 void Driver::addWaitingPlayers() {
 
+	applyRejoins();
+
 	while (!qEmpty()) {
 		lockQ();
 		PlayerMapping mapping = q.front();
 		q.pop();
 		unlockQ();
+
+		if (map.size() >= DEFAULT_NUM_SEATS) {
+			removeBot();
+		}
 		addActivePlayer(&mapping);
 	}
+	seatBots();
+}
+
+/*
+* Seat bots until the table has its bot seats filled or is full
+*/
+void Driver::seatBots() {
+
+	lockNames();
+	int seated = bots.size();
+	unlockNames();
+
+	for (; seated < botSeats && map.size() < DEFAULT_NUM_SEATS; seated++) {
+		addBot();
+	}
+}
+
+/*
+* Seat a new bot under the first free bot name, prefixed with
+* the game id so no two tables share a bot's player record
+*/
+void Driver::addBot() {
+
+	std::string username;
+	int number{1};
+	do {
+		username = Bot::NAME + std::to_string(id) + '-' + std::to_string(number++);
+	}
+	while (hasUserName(&username));
+
+	lockNames();
+	names.insert(username);
+	bots.insert(username);
+	unlockNames();
+
+	PlayerMapping mapping{username, Tcp::NO_FD};
+	addActivePlayer(&mapping);
+}
+
+/*
+* Give up a bot's seat to a waiting player
+*/
+void Driver::removeBot() {
+
+	for (auto mapping : map) {
+		if (isBot(&mapping)) {
+			removePlayer(&mapping);
+			return;
+		}
+	}
+}
+
+/*
+* Return true if the player is a bot without a socket
+*/
+bool Driver::isBot(const PlayerMapping* mapping) const {
+	return mapping->second == Tcp::NO_FD;
+}
+bool Driver::isConnected(const PlayerMapping* mapping) const {
+	return mapping->second >= 0;
 }
 
 /*
@@ -39,7 +105,9 @@ void Driver::addWaitingPlayers() {
 */
 void Driver::signal(bool sig) const {
 	for (const auto mapping : map) {
-		writeTo(mapping.second, sig);
+		if (isConnected(&mapping)) {
+			writeTo(mapping.second, sig);
+		}
 	}
 }
 
@@ -53,6 +121,7 @@ void Driver::checkQuits() {
 		quitQ.pop();
 		removePlayer(&mapping);
 	}
+	dropped.clear();
 }
 
 /*
@@ -62,8 +131,12 @@ void Driver::placeBets() {
 
 	int bet;
 	for (const auto mapping: map) {
-		if ((bet = readFrom(mapping.second)) == Bet::QUIT) {
-			quitQ.push(mapping);
+		if (isBot(&mapping)) {
+			game->placeBet(mapping.first, Bet::MIN);
+		}
+		else if (!readFromPlayer(&mapping.first, BETTING, &bet) || bet == Bet::QUIT) {
+			// The player may have rejoined on a new socket while betting
+			quitQ.push({ mapping.first, map.at(mapping.first) });
 		}
 		else {
 			game->placeBet(mapping.first, bet);
@@ -84,6 +157,11 @@ ROUND_STATUS Driver::getStatus() const {
 
 	int names{namesSz()}, active{map.size()};
 
+	// Bots keep a table running but never keep it open on their own
+	if (humansSz() < 1) {
+		return OVER;
+	}
+
 	//if (active > 1) {
 	//	printf("CONTINUE\n");
 	//	return CONTINUE;
@@ -101,10 +179,101 @@ ROUND_STATUS Driver::getStatus() const {
 }
 
 /*
-* Read the players action from socket
+* Read from player's socket, waiting for them to reconnect
+* if the connection was lost, return false if they never did
 */
-ACTION Driver::readAction(int sock) {
-	return (ACTION) readFrom(sock);
+bool Driver::readFromPlayer(const std::string* username, RESUME_PHASE phase, int* buf) {
+
+	applyRejoin(username, phase);
+
+	// Waiting on a player never holds up a snapshot
+	setBusy(false);
+	bool read{true};
+	// A player restored from a snapshot has no socket until they reconnect
+	while (read && (map.at(*username) < 0 || !tryReadFrom(map.at(*username), buf, sizeof(int)))) {
+		read = awaitRejoin(username, phase);
+	}
+	setBusy(true);
+	return read;
+}
+
+/*
+* Swap in the reconnected player's socket and tell them
+* which phase of the round they are resuming at
+*/
+bool Driver::applyRejoin(const std::string* username, RESUME_PHASE phase) {
+
+	lockRejoin();
+	auto rejoin = rejoins.find(*username);
+	bool found = rejoin != rejoins.end();
+	int sock{Tcp::NO_FD};
+	if (found) {
+		sock = rejoin->second;
+		rejoins.erase(rejoin);
+	}
+	unlockRejoin();
+
+	if (found) {
+		if (map.at(*username) >= 0) {
+			close(map.at(*username));
+		}
+		map.at(*username) = sock;
+		writeTo(sock, (int) phase);
+	}
+	return found;
+}
+void Driver::applyRejoins() {
+	for (const auto mapping : map) {
+		if (!isBot(&mapping)) {
+			applyRejoin(&mapping.first, ROUND);
+		}
+	}
+}
+
+/*
+* Wait for a dropped player to reconnect within the grace period
+*/
+bool Driver::awaitRejoin(const std::string* username, RESUME_PHASE phase) {
+
+	timeval now;
+	gettime(&now);
+	timespec until{ now.tv_sec + Default::RECONNECT_GRACE, now.tv_usec * 1000L };
+
+	lockRejoin();
+	while (!rejoins.count(*username)) {
+		if (pthread_cond_timedwait(&rejoined, &rejoinMtx, &until) == ETIMEDOUT) {
+			break;
+		}
+	}
+	unlockRejoin();
+	return applyRejoin(username, phase);
+}
+
+/*
+* Read the players action from socket,
+* a player who dropped and never returned is queued to quit once
+* and stands on every hand left to them without being read from again
+*/
+ACTION Driver::readAction(const std::string* username) {
+
+	int action;
+	if (dropped.count(*username)) {
+		return STAND;
+	}
+	if (!readFromPlayer(username, TURN, &action)) {
+		dropped.insert(*username);
+		quitQ.push({ *username, map.at(*username) });
+		return STAND;
+	}
+	return (ACTION) action;
+}
+
+/*
+* Look the bot's action up in the basic strategy chart,
+* Decision and ACTION share their order
+*/
+ACTION Driver::botAction(const std::string* username) const {
+	return (ACTION) game->getBasicDecision(*username);
 }
 
 /*
@@ -118,20 +287,24 @@ void Driver::quit(const PlayerMapping* mapping) {
 /*
 * Switch state for given action
 */
-bool Driver::switchAction(stringstream* ss, const std::string* username, ACTION action) {
+bool Driver::switchAction(Renderer* out, const std::string* username, ACTION action) {
 
 	switch (action) {
 	case HIT:
-		*ss << Prompt::HIT;
+		out->append(Prompt::HIT);
 		return game->hit(*username);
 	case SURRENDER:
-		*ss << Prompt::SURRENDER;
+		out->append(Prompt::SURRENDER);
 		return game->surrender(*username);
 	case DOUBLE_DOWN:
-		*ss << Prompt::DOUBLE_DOWN;
+		out->append(Prompt::DOUBLE_DOWN);
 		return game->doubleDown(*username);
+	case SPLIT:
+		out->append(Prompt::SPLIT);
+		return game->split(*username);
 	case STAND:
-		*ss << Prompt::STAND;
+		out->append(Prompt::STAND);
+		return game->stand(*username);
 	default:
 		return false;
 	}
@@ -142,13 +315,17 @@ bool Driver::switchAction(stringstream* ss, const std::string* username, ACTION
 */
 bool Driver::doAction(const PlayerMapping* mapping, ACTION action) {
 	
-	stringstream ss;
-	ss << '\n' << mapping->first << Prompt::ACTION;
+	said.clear();
+	said.append("\n", 1);
+	said.append(mapping->first);
+	said.append(Prompt::ACTION);
 
-	bool canHit = switchAction(&ss, &mapping->first, action);
+	bool canHit = switchAction(&said, &mapping->first, action);
 
-	ss << '\n' << game->displayCards();
-	display(ss.str().c_str());
+	const Renderer& cards = game->renderCards();
+	said.append("\n", 1);
+	said.append(cards.c_str(), cards.size());
+	display(said);
 
 	return canHit;
 }
@@ -173,13 +350,26 @@ void Driver::signalTurnsOver() const {
 void Driver::takeTurn(PlayerMapping* mapping) {
 
 	ACTION action;
+	bool again;
 
 	do {
 		signalTurn();
 		displayTurn(&mapping->first);
-		action = readAction(mapping->second);
+
+		// Clients pause after each hand shown, a bot's move waits until they have read its turn
+		if (isBot(mapping)) {
+			wait(&start, &end, Default::BOT_WAIT);
+		}
+		action = isBot(mapping) ? botAction(&mapping->first) : readAction(&mapping->first);
+		again = doAction(mapping, action);
+
+		// A bot would only ask for a refused action again, it stands instead
+		if (again && isBot(mapping) && game->wasRefused()) {
+			again = doAction(mapping, STAND);
+		}
 	}
-	while (doAction(mapping, action));
+	// Play goes on while a split hand is left
+	while (again);
 }
 
 /*
@@ -199,7 +389,7 @@ void Driver::takeTurns() {
 void Driver::dealer() {
 	game->dealerActions();
 	displayCards();
-	game->settleBets();
+	settle();
 	wait(&start, &end, Default::DISPLAY_WAIT * 2);
 }
 
@@ -207,20 +397,101 @@ void Driver::dealer() {
 * Check if another round to go
 */
 void Driver::checkIfNextRound() {
-	bool nextRound = namesSz() > 1;
+	bool nextRound = namesSz() > 1 && humansSz() > 0;
 	setOver(!nextRound);
 	signal(nextRound);
 }
 
+/*
+* Settle bets and keep the table's image in one step,
+* a snapshot never holds a round the ledger doesn't
+*/
+void Driver::settle() {
+	lockImage();
+	park();
+	game->settleBets();
+	writeImage();
+	unlockImage();
+}
+
+/*
+* Keep the table's image at a round boundary
+*/
+void Driver::keepImage() {
+	lockImage();
+	park();
+	writeImage();
+	unlockImage();
+}
+
+/*
+* Stop the table's thread for good if a snapshot froze the table,
+* the image mutex is held, never released while parked
+*/
+void Driver::park() {
+	if (!frozen) {
+		return;
+	}
+	parked = true;
+	pthread_cond_broadcast(&parkedCond);
+	while (true) {
+		pthread_cond_wait(&parkedCond, &imageMtx);
+	}
+}
+
+/*
+* Mark the table's thread as working on the game or as waiting on
+* its players, parking it if the table was frozen meanwhile
+*/
+void Driver::setBusy(bool isBusy) {
+	lockImage();
+	if (isBusy) {
+		park();
+	}
+	busy = isBusy;
+	pthread_cond_broadcast(&parkedCond);
+	unlockImage();
+}
+
+/*
+* Write the table's id, bot seats, ready status, each player's session
+* and whether they are seated or waiting, the bots and then the Game,
+* the image mutex is held
+*/
+void Driver::writeImage() {
+
+	image.clear();
+	image.put<int32_t>(id);
+	image.put<int32_t>(botSeats);
+	image.put<uint8_t>(gameReady());
+
+	lockNames();
+	image.put<int32_t>(sessions.size());
+	for (const auto& session : sessions) {
+		image.put<Token>(session.first);
+		image.putString(session.second);
+		image.put<uint8_t>(map.count(session.second));
+	}
+	image.put<int32_t>(bots.size());
+	for (const auto& bot : bots) {
+		image.putString(bot);
+	}
+	unlockNames();
+
+	game->writeImage(image);
+}
+
 /*
 * Begin a round in the Game
 */
 void Driver::startRound() {
 
+	setBusy(true);
 	addWaitingPlayers();
 	signal(true);
 	placeBets();
 	checkQuits();
+	keepImage();
 
 	switch (checkStatus()) {
 
@@ -231,17 +502,21 @@ void Driver::startRound() {
 		takeTurns();
 		dealer();
 		displayStats();
+		checkQuits();
 		checkIfNextRound();
 		break;
 
 	case ADD_PLAYER:
+		publish(Prompt::SKIP_ROUND);
 		signal(true);
 		break;
 
 	case OVER:
+		publish(Prompt::GAME_OVER);
 		setOver(true);
 	}
 
+	setBusy(false);
 }
 
 #pragma endregion
@@ -255,6 +530,14 @@ void Driver::initAllMtx() const {
 	init(&namesMtx);
 	init(&qMtx);
 	init(&readyMtx);
+	init(&rejoinMtx);
+	init(&imageMtx);
+	if (pthread_cond_init(&rejoined, nullptr) != 0) {
+		perror(Failure::COND);
+	}
+	if (pthread_cond_init(&parkedCond, nullptr) != 0) {
+		perror(Failure::COND);
+	}
 }
 void Driver::lockNames() const {
 	lock(&namesMtx);
@@ -274,6 +557,18 @@ void Driver::unlockQ() const {
 void Driver::unlockReady() const {
 	unlock(&readyMtx);
 }
+void Driver::lockRejoin() const {
+	lock(&rejoinMtx);
+}
+void Driver::unlockRejoin() const {
+	unlock(&rejoinMtx);
+}
+void Driver::lockImage() const {
+	lock(&imageMtx);
+}
+void Driver::unlockImage() const {
+	unlock(&imageMtx);
+}
 #pragma endregion
 
 /*
@@ -281,9 +576,10 @@ void Driver::unlockReady() const {
 * requires locking and unlocking mutexes
 */
 #pragma region Names, Q, Map
-void Driver::addToNames(const std::string* username) {
+void Driver::addToNames(const std::string* username, Token token) {
 	lockNames();
 	names.insert(*username);
+	sessions[token] = *username;
 	unlockNames();
 }
 void Driver::addToQ(const std::string* username, int sock) {
@@ -300,7 +596,21 @@ void Driver::addToMap(const PlayerMapping* mapping) {
 void Driver::removeFromNames(const std::string* username) {
 	lockNames();
 	names.erase(*username);
+	bots.erase(*username);
+	for (auto session = sessions.begin(); session != sessions.end(); session++) {
+		if (session->second == *username) {
+			sessions.erase(session);
+			break;
+		}
+	}
 	unlockNames();
+
+	lockRejoin();
+	if (rejoins.count(*username)) {
+		close(rejoins.at(*username));
+		rejoins.erase(*username);
+	}
+	unlockRejoin();
 }
 void Driver::removeFromMap(const std::string* username) {
 	map.erase(*username);
@@ -317,6 +627,12 @@ int Driver::namesSz() const {
 	unlockNames();
 	return sz;
 }
+int Driver::humansSz() const {
+	lockNames();
+	int sz = names.size() - bots.size();
+	unlockNames();
+	return sz;
+}
 #pragma endregion
 
 /*
@@ -331,10 +647,42 @@ bool Driver::hasUserName(const std::string* userName) const {
 	unlockNames();
 	return has;
 }
+bool Driver::hasSession(const Token* token) const {
+	lockNames();
+	bool has = sessions.count(*token);
+	unlockNames();
+	return has;
+}
+bool Driver::reattach(const NewPlayer* player) {
+
+	lockNames();
+	bool has = sessions.count(player->token);
+	std::string username{has ? sessions.at(player->token) : ""};
+	unlockNames();
+
+	if (has) {
+		// Told before the game thread can see the socket and write the phase
+		char name[Size::USERNAME]{};
+		strncpy(name, username.c_str(), Size::USERNAME - 1);
+		lockRejoin();
+		writeTo(player->sock, true);
+		writeTo(player->sock, name, Size::USERNAME);
+		if (rejoins.count(username)) {
+			close(rejoins.at(username));
+		}
+		rejoins[username] = player->sock;
+		pthread_cond_broadcast(&rejoined);
+		unlockRejoin();
+	}
+	return has;
+}
+bool Driver::addWatcher(int sock) {
+	return broadcast->addWatcher(sock);
+}
 bool Driver::addPlayer(const NewPlayer* player) {
 
 	if (!gameFull()) {
-		addToNames(&player->userName);
+		addToNames(&player->userName, player->token);
 		addToQ(&player->userName, player->sock);
 		setReady();
 		return true;
@@ -342,7 +690,9 @@ bool Driver::addPlayer(const NewPlayer* player) {
 	return false;
 }
 void Driver::removePlayer(const PlayerMapping* mapping) {
-	close(mapping->second);
+	if (isConnected(mapping)) {
+		close(mapping->second);
+	}
 	removeFromNames(&mapping->first);
 	removeFromMap(&mapping->first);
 	game->removePlayer(mapping->first);
@@ -350,7 +700,7 @@ void Driver::removePlayer(const PlayerMapping* mapping) {
 std::string Driver::userNameList() const {
 
 	std::stringstream ss;
-	ss << Prompt::LIST1 << id << Prompt::LIST2;
+	ss << Prompt::LIST1 << id << Prompt::LIST3 << game->getRules().name << Prompt::LIST2;
 
 	lockNames();
 	for (const auto name : names) {
@@ -364,7 +714,8 @@ std::string Driver::userNameList() const {
 #pragma endregion
 
 /*
-* Checking Game's ID, ready or over status
+* Checking Game's ID, ready or over status,
+* freezing it for a snapshot
 */
 #pragma region Game
 int Driver::gameId() const {
@@ -377,11 +728,25 @@ bool Driver::gameReady() const {
 	return isReady;
 }
 bool Driver::gameFull() const {
-	return namesSz() >= DEFAULT_NUM_SEATS;
+	// A bot gives up its seat to a joining player
+	return humansSz() >= DEFAULT_NUM_SEATS;
 }
 bool Driver::gameOver() const {
 	return over;
 }
+bool Driver::freeze(SnapshotWriter* snapshot) {
+	lockImage();
+	frozen = true;
+	while (busy && !parked) {
+		pthread_cond_wait(&parkedCond, &imageMtx);
+	}
+	bool isOver = gameOver();
+	if (!isOver) {
+		snapshot->putImage(image);
+	}
+	unlockImage();
+	return !isOver;
+}
 void Driver::setReady() {
 	lockReady();
 	ready = true;
@@ -397,42 +762,116 @@ void Driver::setOver(bool isOver) {
 */
 #pragma region Display
 void Driver::display(const char msg[]) const {
-	for (const auto mapping : map) {
-		writeTo(mapping.second, msg, strlen(msg));
+	display(msg, strlen(msg));
+}
+void Driver::display(const Renderer& text) const {
+	display(text.c_str(), text.size());
+}
+void Driver::display(const char msg[], int sz) const {
+	for (const auto& mapping : map) {
+		if (isConnected(&mapping)) {
+			writeTo(mapping.second, msg, sz);
+		}
 	}
+	broadcast->publish(msg, sz);
+}
+void Driver::publish(const char msg[]) const {
+	broadcast->publish(msg, strlen(msg));
 }
 void Driver::display(ROUND_STATUS status) const {
-	for (const auto mapping : map) {
-		writeTo(mapping.second, status);
+	for (const auto& mapping : map) {
+		if (isConnected(&mapping)) {
+			writeTo(mapping.second, status);
+		}
 	}
 }
 void Driver::displayCards() const {
-	display(game->displayCards().c_str());
+	display(game->renderCards());
 	wait(&start, &end, Default::DISPLAY_WAIT);
 }
 void Driver::displayTurn(const std::string* username) const {
-	display(username->c_str());
+	for (const auto& mapping : map) {
+		if (isConnected(&mapping)) {
+			writeTo(mapping.second, username->c_str(), username->size());
+		}
+	}
+	publish(Prompt::TURN1);
+	broadcast->publish(username->c_str(), username->size());
+	publish(Prompt::TURN2);
 }
 void Driver::displayStats() const {
-	display(game->printStats().c_str());
+	display(game->renderStats());
 	wait(&start, &end, Default::DISPLAY_WAIT * 2);
 }
 #pragma endregion
 
 /*
 * Construct driver with username and game id to pass to Game,
-* destruct driver by deallocating Game memory
+* or restore it from its image in a snapshot, read in the order
+* writeImage wrote it, destruct driver by deallocating Game memory
 */
 #pragma region Constructor, Destructor
 
-Driver::Driver(const NewPlayer* player)  :id{player->gameId},
-										  game{new Game{player->userName, id}},
-										  ready{false}, over{false} {
+Driver::Driver(const NewPlayer* player, int botSeats, const TableRules* rules, PlayerPool* pool, HandHistory* history, Ledger* ledger)  :id{player->gameId},
+										  game{new Game{player->userName, id, *rules, pool, history, ledger}},
+										  ready{false}, over{false},
+										  botSeats{botSeats},
+										  broadcast{new Broadcast},
+										  frozen{false}, parked{false}, busy{false} {
 	initAllMtx();
-	addToNames(&player->userName); 
+	addToNames(&player->userName, player->token);
 	addToMap(&player->userName, player->sock);
+
+	// With bots seated the creator doesn't wait for a second player
+	seatBots();
+	if (botSeats > 0) {
+		setReady();
+	}
+	writeImage();
+}
+Driver::Driver(SnapshotReader* snapshot, PlayerPool* pool, HandHistory* history, Ledger* ledger)  :id{snapshot->get<int32_t>()},
+										  game{nullptr},
+										  ready{false}, over{false},
+										  botSeats{snapshot->get<int32_t>()},
+										  broadcast{new Broadcast},
+										  frozen{false}, parked{false}, busy{false} {
+	initAllMtx();
+	bool isReady = snapshot->get<uint8_t>();
+
+	// Players are seated or waiting with no socket until they reconnect
+	int sessionsSz = snapshot->get<int32_t>();
+	for (int i = 0; i < sessionsSz && snapshot->check(i < DEFAULT_NUM_SEATS); i++) {
+		Token token = snapshot->get<Token>();
+		std::string username{snapshot->getString()};
+		bool seated = snapshot->get<uint8_t>();
+		addToNames(&username, token);
+		if (seated) {
+			addToMap(&username, Tcp::DROPPED_FD);
+		}
+		else {
+			addToQ(&username, Tcp::DROPPED_FD);
+		}
+	}
+
+	int botsSz = snapshot->get<int32_t>();
+	for (int i = 0; i < botsSz && snapshot->check(i < DEFAULT_NUM_SEATS); i++) {
+		std::string username{snapshot->getString()};
+		lockNames();
+		names.insert(username);
+		bots.insert(username);
+		unlockNames();
+		addToMap(&username, Tcp::NO_FD);
+	}
+
+	game = new Game{*snapshot, pool, history, ledger};
+	snapshot->check(game->getGameID() == id);
+	if (isReady) {
+		setReady();
+	}
+	writeImage();
 }
 Driver::~Driver() {
+	delete broadcast;
 	delete game;
 }
 #pragma endregion
@@ -10,6 +10,7 @@
 #include <set>
 #include <queue>
 #include "Utilities.h"
+#include "Broadcast.h"
 #include "Game.h"
 
 
@@ -18,7 +19,12 @@ class Driver {
 	/*
 	* Mutexes for thread safety on shared resources
 	*/
-	mutable pthread_mutex_t namesMtx, qMtx, readyMtx;
+	mutable pthread_mutex_t namesMtx, qMtx, readyMtx, rejoinMtx, imageMtx;
+
+	/*
+	* Signalled on the rejoin mutex when a player reconnects
+	*/
+	mutable pthread_cond_t rejoined;
 
 	/*
 	* Set of player names for new player threads to access without
@@ -26,6 +32,24 @@ class Driver {
 	*/
 	std::set<std::string> names;
 
+	/*
+	* Names of the bot players seated, a subset of names
+	* sharing the names mutex
+	*/
+	std::set<std::string> bots;
+
+	/*
+	* Map session token to username for players reconnecting,
+	* shares the names mutex
+	*/
+	std::map<Token, std::string> sessions;
+
+	/*
+	* Sockets of reconnected players waiting to replace their
+	* dropped socket at the next point the game thread reads from them
+	*/
+	std::map<std::string, int> rejoins;
+
 	/*
 	* For other threads to add new players who will wait
 	* until the beggining of next round
@@ -42,6 +66,12 @@ class Driver {
 	*/
 	std::queue<PlayerMapping> quitQ;
 
+	/*
+	* Players who dropped in their turn and never returned,
+	* already queued to quit, they stand on their remaining hands
+	*/
+	std::set<std::string> dropped;
+
 	/*
 	* BlackJack game to drive with id,
 	* ready status and over status
@@ -50,6 +80,36 @@ class Driver {
 	Game* game;
 	bool ready, full, over;
 
+	/*
+	* Bot seats kept filled while there is room for them
+	*/
+	const int botSeats;
+
+	/*
+	* Live event stream for spectators
+	*/
+	Broadcast* broadcast;
+
+	/*
+	* Reused buffer for an action's message and the hands after it
+	*/
+	Renderer said;
+
+	/*
+	* Image of the table at its last round boundary for a snapshot,
+	* guarded by the image mutex
+	*/
+	SnapshotWriter image;
+
+	/*
+	* Whether a snapshot froze the table, whether the table's thread
+	* stopped for good at a round boundary and whether it is between
+	* reads from its players, all guarded by the image mutex and
+	* signalled through the parked condition
+	*/
+	bool frozen, parked, busy;
+	mutable pthread_cond_t parkedCond;
+
 	/*
 	* Timers for pausing thread execution to let players see
 	* displayed information before next round
@@ -57,10 +117,14 @@ class Driver {
 	mutable timeval start, end;
 
 	/*
-	* Display the given message at socket for each player
+	* Display the given message at socket for each player,
+	* published once to spectators
 	*/
 	void display(const char msg[]) const;
+	void display(const char msg[], int sz) const;
+	void display(const Renderer& text) const;
 	void display(ROUND_STATUS status) const;
+	void publish(const char msg[]) const;
 	void displayTurn(const std::string* username) const;
 	void displayCards() const;
 	void displayStats() const;
@@ -80,6 +144,28 @@ class Driver {
 	*/
 	void addWaitingPlayers();
 
+	/*
+	* Seat bots until the table has its bot seats filled or is full
+	*/
+	void seatBots();
+
+	/*
+	* Seat a new bot, give up a bot's seat to a waiting player
+	*/
+	void addBot();
+	void removeBot();
+
+	/*
+	* Return true if the player is a bot without a socket
+	*/
+	bool isBot(const PlayerMapping*) const;
+
+	/*
+	* Return true if the player has a socket, false for a bot
+	* or a player restored from a snapshot who hasn't reconnected
+	*/
+	bool isConnected(const PlayerMapping*) const;
+
 	/*
 	* Send signal to all players
 	*/
@@ -101,10 +187,33 @@ class Driver {
 	ROUND_STATUS checkStatus() const;
 	ROUND_STATUS getStatus() const;
 
+	/*
+	* Read from player's socket, waiting for them to reconnect
+	* if the connection was lost, return false if they never did
+	*/
+	bool readFromPlayer(const std::string* username, RESUME_PHASE, int* buf);
+
+	/*
+	* Swap in the reconnected player's socket and tell them
+	* which phase of the round they are resuming at
+	*/
+	bool applyRejoin(const std::string* username, RESUME_PHASE);
+	void applyRejoins();
+
+	/*
+	* Wait for a dropped player to reconnect within the grace period
+	*/
+	bool awaitRejoin(const std::string* username, RESUME_PHASE);
+
 	/*
 	* Read the players action from socket
 	*/
-	static ACTION readAction(int sock);
+	ACTION readAction(const std::string* username);
+
+	/*
+	* Look the bot's action up in the basic strategy chart
+	*/
+	ACTION botAction(const std::string* username) const;
 	
 	/*
 	* Player quits game
@@ -114,7 +223,7 @@ class Driver {
 	/*
 	* Switch state for given action
 	*/
-	bool switchAction(stringstream*, const std::string* username, ACTION);
+	bool switchAction(Renderer*, const std::string* username, ACTION);
 
 	/*
 	* Do the player's given action
@@ -151,6 +260,30 @@ class Driver {
 	*/
 	void checkIfNextRound();
 
+	/*
+	* Settle bets and keep the table's image in one step,
+	* a snapshot never holds a round the ledger doesn't
+	*/
+	void settle();
+
+	/*
+	* Keep the table's image at a round boundary
+	*/
+	void keepImage();
+	void writeImage();
+
+	/*
+	* Stop the table's thread for good if a snapshot froze the table,
+	* the image mutex is held
+	*/
+	void park();
+
+	/*
+	* Mark the table's thread as working on the game or as waiting on
+	* its players, parking it if the table was frozen meanwhile
+	*/
+	void setBusy(bool isBusy);
+
 	/*
 	* Remove the player with the given username
 	*/
@@ -168,12 +301,16 @@ class Driver {
 	void unlockQ() const;
 	void lockReady() const;
 	void unlockReady() const;
+	void lockRejoin() const;
+	void unlockRejoin() const;
+	void lockImage() const;
+	void unlockImage() const;
 
 	/*
 	* Add to / remove from resources used by multiple threads,
 	* requires locking and unlocking mutexes
 	*/
-	void addToNames(const std::string* username);
+	void addToNames(const std::string* username, Token);
 	void addToQ(const std::string* username, int sock);
 	void addToMap(const std::string* username, int sock);
 	void addToMap(const PlayerMapping*);
@@ -181,9 +318,10 @@ class Driver {
 	void removeFromMap(const std::string* username);
 
 	/*
-	* Return amount of names/players
+	* Return amount of names/players, and of those the humans
 	*/
 	int namesSz() const;
+	int humansSz() const;
 
 	/*
 	* Set ready to true once there are at least two players
@@ -198,9 +336,17 @@ class Driver {
 public:
 
 	/*
-	* Create driver with username and game id to pass to Game
+	* Create driver with username and game id to pass to Game,
+	* the number of bot seats to keep filled, the table's rules,
+	* the server's player records, hand history log and player ledger
 	*/
-	explicit Driver(const NewPlayer*);
+	Driver(const NewPlayer*, int botSeats, const TableRules* rules, PlayerPool* pool, HandHistory* history, Ledger* ledger);
+
+	/*
+	* Restore driver from its image in a snapshot, its players wait
+	* to reconnect with their session tokens
+	*/
+	Driver(SnapshotReader* snapshot, PlayerPool* pool, HandHistory* history, Ledger* ledger);
 
 	/*
 	* Deallocate the Game pointer
@@ -220,6 +366,22 @@ public:
 	*/
 	bool hasUserName(const std::string* userName) const;
 
+	/*
+	* Return true if the session token belongs to a player in game
+	*/
+	bool hasSession(const Token*) const;
+
+	/*
+	* Reattach a reconnected player to their seat with a new socket,
+	* telling them they resumed and the seat's username first
+	*/
+	bool reattach(const NewPlayer*);
+
+	/*
+	* Attach a read-only spectator to the game's event stream
+	*/
+	bool addWatcher(int sock);
+
 	/*
 	* Return all user names on seperate lines in a single string
 	*/
@@ -235,5 +397,12 @@ public:
 	*/
 	void startRound();
 
+	/*
+	* Freeze the table, wait until its thread is parked or waiting on
+	* its players and add the table's last image to a snapshot,
+	* return false if the game is over
+	*/
+	bool freeze(SnapshotWriter* snapshot);
+
 };
 #endif
@@ -0,0 +1,207 @@
+//-----------------------------ExpectedValue.cpp--------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the implementation file for the ExpectedValue class. It
+//             computes the exact expected value, in initial bets, of standing,
+//             hitting, doubling down and surrendering for a Player's hand
+//             against the dealer's upcard, given the Composition of the cards
+//             the Player has not seen. Every subproblem is memoized by the
+//             Composition and the hand.
+//------------------------------------------------------------------------------
+#include "ExpectedValue.h"
+
+//Hand states in a key: upcard 1 to 10, hard total 0 to 31, Ace or not
+static const int HAND_STATES = (NUM_RANKS + 1) * 32 * 2;
+
+//-------------------------------ExpectedValue----------------------------------
+//Description: Constructor for ExpectedValue.
+//Parameters:  - numDecks: Number of decks in the shoe, at most MAX_ODDS_DECKS.
+//------------------------------------------------------------------------------
+ExpectedValue::ExpectedValue(const int numDecks)
+    : dealerOdds(numDecks), keys(numDecks < MAX_ODDS_DECKS ? numDecks : MAX_ODDS_DECKS, HAND_STATES)
+{
+    this->cache.reserve(1 << 16);
+} // end of ExpectedValue
+
+//--------------------------------getCacheSize----------------------------------
+//Description: Returns the number of memoized hands, not counting the dealer's.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+int ExpectedValue::getCacheSize() const
+{
+    return this->cache.size();
+} // end of getCacheSize
+
+//---------------------------------clearCache-----------------------------------
+//Description: Empties the hand cache and the dealer's cache.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+void ExpectedValue::clearCache()
+{
+    this->cache.clear();
+    this->dealerOdds.clearCache();
+} // end of clearCache
+
+//---------------------------------getValues------------------------------------
+//Description: Returns the expected value of every action for the hand. The
+//             unseen Composition is the shoe plus the dealer's hole card, i.e.
+//             everything except the Player's cards, the upcard, and any other
+//             cards already shown at the table.
+//Parameters:  - unseen:      Cards the Player has not seen.
+//             - hardTotal:   Player's total with every Ace as 1.
+//             - hasAce:      Whether or not the Player holds an Ace.
+//             - upcard:      Rank of the dealer's upcard.
+//             - firstAction: Whether or not the Player has acted yet; double
+//                            down is only allowed as the first action.
+//------------------------------------------------------------------------------
+ActionValues ExpectedValue::getValues(const Composition &unseen, int hardTotal, bool hasAce, int upcard, bool firstAction)
+{
+    if (this->cache.size() >= MAX_CACHE)
+    {
+        clearCache();
+    }
+    Composition shoe(unseen);
+    ActionValues values;
+    values.stand = stand(shoe, hardTotal, hasAce, upcard);
+    values.hit = hit(shoe, hardTotal, hasAce, upcard);
+    values.doubleDown = firstAction ? doubleDown(shoe, hardTotal, hasAce, upcard) : values.hit;
+    values.surrender = SURRENDER_VALUE;
+
+    values.best = Decision::STAND;
+    double bestValue = values.stand;
+    if (values.hit > bestValue)
+    {
+        values.best = Decision::HIT;
+        bestValue = values.hit;
+    }
+    if (firstAction && values.doubleDown > bestValue)
+    {
+        values.best = Decision::DOUBLE_DOWN;
+        bestValue = values.doubleDown;
+    }
+    if (values.surrender > bestValue)
+    {
+        values.best = Decision::SURRENDER;
+    }
+    return values;
+} // end of getValues
+
+//-----------------------------------stand--------------------------------------
+//Description: Private function that returns the value of standing: the Player
+//             wins if the dealer BUSTs or stands lower, pushes on the same
+//             total, and loses otherwise.
+//Parameters:  - shoe:      Cards the Player has not seen.
+//             - hardTotal: Player's total with every Ace as 1.
+//             - hasAce:    Whether or not the Player holds an Ace.
+//             - upcard:    Rank of the dealer's upcard.
+//------------------------------------------------------------------------------
+double ExpectedValue::stand(const Composition &shoe, int hardTotal, bool hasAce, int upcard)
+{
+    if (hardTotal > BLACKJACK)
+    {
+        return -1;
+    }
+    int points = hardTotal;
+    if (hasAce && hardTotal + SOFT_BONUS <= BLACKJACK)
+    {
+        points += SOFT_BONUS;
+    }
+    const DealerProbabilities &dealer = this->dealerOdds.getProbabilities(shoe, upcard);
+    double value = dealer.bust;
+    for (int i = 0; i < DEALER_TOTALS; i++)
+    {
+        if (DEALER_STAND + i < points)
+        {
+            value += dealer.total[i];
+        }
+        else if (DEALER_STAND + i > points)
+        {
+            value -= dealer.total[i];
+        }
+    }
+    return value;
+} // end of stand
+
+//------------------------------------hit---------------------------------------
+//Description: Private function that returns the value of taking one card and
+//             then playing on as well as possible.
+//Parameters:  - shoe:      Cards the Player has not seen.
+//             - hardTotal: Player's total with every Ace as 1.
+//             - hasAce:    Whether or not the Player holds an Ace.
+//             - upcard:    Rank of the dealer's upcard.
+//------------------------------------------------------------------------------
+double ExpectedValue::hit(Composition &shoe, int hardTotal, bool hasAce, int upcard)
+{
+    double value = 0;
+    for (int rank = ACE; rank <= NUM_RANKS && shoe.getTotal() > 0; rank++)
+    {
+        double chance = shoe.getProbability(rank);
+        if (chance == 0)
+        {
+            continue;
+        }
+        if (hardTotal + rank > BLACKJACK)
+        {
+            value -= chance;
+            continue;
+        }
+        shoe.removeCard(rank);
+        value += chance * best(shoe, hardTotal + rank, hasAce || rank == ACE, upcard);
+        shoe.addCard(rank);
+    }
+    return value;
+} // end of hit
+
+//---------------------------------doubleDown-----------------------------------
+//Description: Private function that returns the value of doubling the bet and
+//             standing after exactly one more card.
+//Parameters:  - shoe:      Cards the Player has not seen.
+//             - hardTotal: Player's total with every Ace as 1.
+//             - hasAce:    Whether or not the Player holds an Ace.
+//             - upcard:    Rank of the dealer's upcard.
+//------------------------------------------------------------------------------
+double ExpectedValue::doubleDown(Composition &shoe, int hardTotal, bool hasAce, int upcard)
+{
+    double value = 0;
+    for (int rank = ACE; rank <= NUM_RANKS && shoe.getTotal() > 0; rank++)
+    {
+        double chance = shoe.getProbability(rank);
+        if (chance == 0)
+        {
+            continue;
+        }
+        shoe.removeCard(rank);
+        value += chance * stand(shoe, hardTotal + rank, hasAce || rank == ACE, upcard);
+        shoe.addCard(rank);
+    }
+    return 2 * value;
+} // end of doubleDown
+
+//------------------------------------best--------------------------------------
+//Description: Private function that returns the value of the best of standing,
+//             hitting and surrendering after a hit, memoized by the Composition
+//             and the hand. Hitting 21 can never help, so it stands.
+//Parameters:  - shoe:      Cards the Player has not seen.
+//             - hardTotal: Player's total with every Ace as 1.
+//             - hasAce:    Whether or not the Player holds an Ace.
+//             - upcard:    Rank of the dealer's upcard.
+//------------------------------------------------------------------------------
+double ExpectedValue::best(Composition &shoe, int hardTotal, bool hasAce, int upcard)
+{
+    unsigned long long key = this->keys.encode(shoe, (upcard * 32 + hardTotal) * 2 + hasAce);
+    auto cached = this->cache.find(key);
+    if (cached != this->cache.end())
+    {
+        return cached->second;
+    }
+    double value = stand(shoe, hardTotal, hasAce, upcard);
+    bool soft = hasAce && hardTotal + SOFT_BONUS <= BLACKJACK;
+    int points = soft ? hardTotal + SOFT_BONUS : hardTotal;
+    if (points < BLACKJACK)
+    {
+        value = max(value, hit(shoe, hardTotal, hasAce, upcard));
+    }
+    value = max(value, SURRENDER_VALUE);
+    this->cache[key] = value;
+    return value;
+} // end of best
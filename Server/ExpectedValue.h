@@ -0,0 +1,57 @@
+//------------------------------ExpectedValue.h---------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the header file for the ExpectedValue class. It computes
+//             the exact expected value, in initial bets, of standing, hitting,
+//             doubling down and surrendering for a Player's hand against the
+//             dealer's upcard, given the Composition of the cards the Player
+//             has not seen. The rules are those of Game: Game::hit draws one
+//             card, Game::doubleDown doubles the bet for exactly one card,
+//             Game::surrender loses half the bet at any point in the turn, and
+//             Game::settleBets pays even money on a win and pushes on a tie.
+//             After a hit the Player continues with the best of standing,
+//             hitting or surrendering. Every subproblem is memoized by the
+//             Composition and the hand, and the dealer's odds come from
+//             DealerOdds, so a warm query is answered from the caches.
+//------------------------------------------------------------------------------
+#ifndef EXPECTEDVALUE_H
+#define EXPECTEDVALUE_H
+#include <unordered_map>
+#include <algorithm>
+#include "Rules.h"
+#include "Composition.h"
+#include "DealerOdds.h"
+using namespace std;
+
+static const double SURRENDER_VALUE = -0.5;     //Surrender loses half the bet (see Game::settleBets)
+
+struct ActionValues
+{
+    double stand;       //Expected value of standing
+    double hit;         //Expected value of hitting, then playing on as well as possible
+    double doubleDown;  //Expected value of doubling down, or a hit's value when not allowed
+    double surrender;   //Expected value of surrendering
+    Decision best;      //Action with the highest expected value
+};
+
+class ExpectedValue
+{
+    private:
+        DealerOdds dealerOdds;                              //Dealer's final total probabilities
+        CompositionKey keys;                                //Encodes the shoe and the hand
+        unordered_map<unsigned long long, double> cache;    //Best value of each hand and shoe
+        double stand(const Composition &shoe, int hardTotal, bool hasAce, int upcard);
+        double hit(Composition &shoe, int hardTotal, bool hasAce, int upcard);
+        double doubleDown(Composition &shoe, int hardTotal, bool hasAce, int upcard);
+        double best(Composition &shoe, int hardTotal, bool hasAce, int upcard);
+
+    public:
+        //Constructors
+        ExpectedValue(const int numDecks);
+        //Getters
+        int getCacheSize() const;
+        //Setters
+        ActionValues getValues(const Composition &unseen, int hardTotal, bool hasAce, int upcard, bool firstAction);
+        void clearCache();
+};
+#endif
@@ -3,14 +3,15 @@
 //Team: LuckyNo13
 //Description: This is the implementation file for the Game class. It is the controller
 //             class that aggregates all other objects in the game. It contains
-//             a vector for Seats, a Deck called a shoe that contains all the 
+//             an array of Seats, a Deck called a shoe that contains all the 
 //             Card objects currently in play, a flag for whether or not the
 //             round is active, values for the game's ID, how many total Players
 //             and active Players, the round number, and private functions to
 //             discard the dealer's hand, update the dealer's Cards point values,
 //             and initialize the Seats when the game starts. It exposes functions
-//             to retrieve and modify those attributes. The class is used within
-//             a driver file and is created by a driver.
+//             to retrieve and modify those attributes. Each table plays by its
+//             own TableRules and keeps its hands in a TableState. The class is
+//             used within a driver file and is created by a driver.
 //------------------------------------------------------------------------------
 #include "Game.h"
 
@@ -19,21 +20,85 @@
 //             receiving a username and a game ID.
 //Parameters: - username:   Player who created the game.
 //            - gameID:     Identifier for this game.
+//            - rules:      Rules the table is played by.
+//            - pool:       Server's player records, or nullptr for none.
+//            - history:    Server's hand history log, or nullptr for none.
+//            - ledger:     Server's player ledger, or nullptr for none.
+//            - seed:       Seed to shuffle the shoe from, or CLOCK_SEED.
 //------------------------------------------------------------------------------
-Game::Game(string username, const int gameID)
+Game::Game(string username, const int gameID, const TableRules &rules, PlayerPool* pool, HandHistory* history,
+    Ledger* ledger, unsigned long long seed)
 {
+    this->pool = pool;
+    this->history = history;
+    this->ledger = ledger;
+    this->recording = history != nullptr;
+    this->seed = seed != CLOCK_SEED ? seed : chrono::system_clock::now().time_since_epoch().count();
     this->gameID = gameID;
     this->totalPlayers = 0;
     this->dealerPoints = 0;
     this->roundNum = 0;
-    this->shoe = new Deck(DEFAULT_DECK_SIZE);
+    this->rules = rules;
+    this->shoe = new Deck(rules.decks, this->seed);
+    this->refused = false;
+    this->dealerHand.reserve(MAX_HAND_CARDS);
     initializeSeats();
     addPlayer(username);
 } // end of Game
 
+//------------------------------------Game--------------------------------------
+//Description: Constructor for a Game rebuilt between rounds from the image
+//             writeImage wrote, with the same players seated where they sat and
+//             the same shoe. Its players sit down again in its next record. The
+//             image is marked bad if it doesn't hold a Game.
+//Parameters: - image:      Snapshot image, read up to the end of the Game's.
+//            - pool:       Server's player records, or nullptr for none.
+//            - history:    Server's hand history log, or nullptr for none.
+//            - ledger:     Server's player ledger, or nullptr for none.
+//------------------------------------------------------------------------------
+Game::Game(SnapshotReader &image, PlayerPool* pool, HandHistory* history, Ledger* ledger)
+{
+    this->pool = pool;
+    this->history = history;
+    this->ledger = ledger;
+    this->recording = history != nullptr;
+    this->gameID = image.get<int32_t>();
+    this->seed = image.get<uint64_t>();
+    this->roundNum = image.get<int32_t>();
+    this->totalPlayers = 0;
+    this->dealerPoints = 0;
+    string rulesName = image.getString();
+    const TableRules* variant = nullptr;
+    for (const TableRules* named : RULE_VARIANTS)
+    {
+        if (rulesName == named->name)
+        {
+            variant = named;
+        }
+    }
+    image.check(variant != nullptr && this->roundNum >= 0);
+    this->rules = variant != nullptr ? *variant : HOUSE_RULES;
+    this->refused = false;
+    this->dealerHand.reserve(MAX_HAND_CARDS);
+    initializeSeats();
+    for (int i = 0; i < DEFAULT_NUM_SEATS; i++)
+    {
+        if (image.get<uint8_t>() != 0)
+        {
+            string username = image.getString();
+            int balance = image.get<int32_t>();
+            int wins = image.get<int32_t>();
+            int losses = image.get<int32_t>();
+            seatPlayer(Player(username, balance, wins, losses), i);
+        }
+    }
+    this->shoe = new Deck(image);
+} // end of Game
+
 //------------------------------------~Game-------------------------------------
 //Description: Deconstructor for Game. Clears memory created for the shoe and
-//             seats.
+//             the cards still in the Seats' hands, and returns the records of
+//             players still seated to the pool.
 //Parameters:  N/A
 //------------------------------------------------------------------------------
 Game::~Game()
@@ -41,12 +106,18 @@ Game::~Game()
     delete shoe;
     for (int i = 0; i < DEFAULT_NUM_SEATS; i++)
     {
-        delete seats[i];
+        clearHands(i);
+        if (pool != nullptr && seats[i].isSeated())
+        {
+            pool->checkIn(*seats[i].getPlayer());
+        }
     }
+    discardHand();
 } // end of ~Game
 
 //--------------------------------removePlayer----------------------------------
-//Description: Public function that removes a specified player from the game.
+//Description: Public function that removes a specified player from the game
+//             and returns their record to the pool.
 //Parameters:  - username: Specified player.
 //------------------------------------------------------------------------------
 bool Game::removePlayer(string username)
@@ -55,23 +126,28 @@ bool Game::removePlayer(string username)
     {
         return false;
     }
-    for (int i = 0; i < DEFAULT_NUM_SEATS; i++)
+    int seat = findSeat(username);
+    if (seat < 0)
     {
-        if (seats[i]->isSeated())
-        {
-            if (this->seats[i]->getPlayer()->getName() == username)
-            {
-                this->seats[i]->unseatPlayer();
-                this->totalPlayers--;
-                return true;
-            }
-        }
+        return false;
     }
-    return false;
+    if (record.isRecording())
+    { //Left in the middle of the round
+        logEvent(HistoryAction::LEAVE, seat, table.activeHand[seat]);
+    }
+    clearHands(seat);
+    if (pool != nullptr)
+    {
+        pool->checkIn(*seats[seat].getPlayer());
+    }
+    this->seats[seat].unseatPlayer();
+    this->totalPlayers--;
+    return true;
 } // end of removePlayer
 
 //----------------------------------addPlayer-----------------------------------
-//Description: Public function that adds a specified player to the game.
+//Description: Public function that adds a specified player to the game with
+//             their record from the pool, or a new record if they have none.
 //Parameters:  - username: Specified player.
 //------------------------------------------------------------------------------
 bool Game::addPlayer(string username)
@@ -80,32 +156,239 @@ bool Game::addPlayer(string username)
     {
         return false;
     }
-    Player *newPlayer = new Player(username);
-    for (int i = 0; i < DEFAULT_NUM_SEATS; i++) //Otherwise, create and seat player
+    for (int i = 0; i < DEFAULT_NUM_SEATS; i++) //Otherwise, seat player
     {
-        if (!seats[i]->isSeated()) //Empty seat
+        if (!seats[i].isSeated()) //Empty seat
         {
-            seats[i]->seatPlayer(newPlayer);
-            this->totalPlayers++;
-            return true;
+            return seatPlayer(pool != nullptr ? pool->checkOut(username) : Player(username), i);
         }
     }
     return false;
 } // end of addPlayer
 
+//---------------------------------seatPlayer-----------------------------------
+//Description: Public function that seats a player's record at an empty seat,
+//             as a replay does with the balance its records give.
+//Parameters:  - player: Player's record.
+//             - seat:   Seat to sit at.
+//------------------------------------------------------------------------------
+bool Game::seatPlayer(const Player &player, int seat)
+{
+    if (seat < 0 || seat >= DEFAULT_NUM_SEATS || seats[seat].isSeated())
+    {
+        return false;
+    }
+    seats[seat].seatPlayer(player);
+    this->joined[seat] = true;
+    this->totalPlayers++;
+    return true;
+} // end of seatPlayer
+
 //-------------------------------initializeSeats--------------------------------
-//Description: Private function that creates all the new seat objects.
+//Description: Private function that gives every seat a single empty hand in
+//             the table state.
 //Parameters:  N/A
 //------------------------------------------------------------------------------
 void Game::initializeSeats()
 {
     for (int i = 0; i < DEFAULT_NUM_SEATS; i++)
     {
-        Seat *newSeat = new Seat();
-        this->seats[i] = newSeat;
+        this->joined[i] = false;
+        this->table.numHands[i] = MAX_HANDS;
+        for (int h = 0; h < MAX_HANDS; h++)
+        {
+            this->table.numCards[i][h] = 0;
+        }
+        clearHands(i);
     }
 } // end of initializeSeats
 
+//----------------------------------findSeat------------------------------------
+//Description: Private function that returns the index of the seat the
+//             specified player sits in, or -1 if they are not seated.
+//Parameters:  - username: Specified player.
+//------------------------------------------------------------------------------
+int Game::findSeat(const string &username) const
+{
+    for (int i = 0; i < DEFAULT_NUM_SEATS; i++)
+    {
+        if (seats[i].isSeated() && seats[i].getPlayer()->getName() == username)
+        {
+            return i;
+        }
+    }
+    return -1;
+} // end of findSeat
+
+//-----------------------------------addCard------------------------------------
+//Description: Private function that adds a card to a seat's active hand and
+//             scores it. A hand with no room left destroys the card.
+//Parameters:  - seat: Index of the seat receiving the card.
+//             - card: A pointer for a card in the round's Arena.
+//------------------------------------------------------------------------------
+void Game::addCard(int seat, Card* card)
+{
+    int hand = this->table.activeHand[seat];
+    if (this->table.numCards[seat][hand] >= MAX_HAND_CARDS)
+    {
+        arena.destroy(card);
+        return;
+    }
+    this->table.cards[seat][hand][this->table.numCards[seat][hand]++] = card;
+    scoreHand(seat, hand);
+} // end of addCard
+
+//----------------------------------scoreHand-----------------------------------
+//Description: Private function that totals a hand, counting each Ace as 11
+//             until that would BUST the hand and as 1 after, and marks whether
+//             an Ace is still counted as 11.
+//Parameters:  - seat: Index of the seat holding the hand.
+//             - hand: Index of the hand.
+//------------------------------------------------------------------------------
+void Game::scoreHand(int seat, int hand)
+{
+    Card** cards = this->table.cards[seat][hand];
+    int numCards = this->table.numCards[seat][hand];
+    int points = 0;
+    int softAces = 0;
+    for (int i = 0; i < numCards; i++)
+    {
+        if (cards[i]->getFace() == "A")
+        {
+            cards[i]->setValue(11);
+            softAces++;
+        }
+        points += cards[i]->getValue();
+    }
+    for (int i = 0; i < numCards && points > BLACKJACK; i++)
+    {
+        if (cards[i]->getFace() == "A")
+        {
+            cards[i]->setValue(1);
+            points -= 10;
+            softAces--;
+        }
+    }
+    this->table.points[seat][hand] = points;
+    if (softAces > 0)
+    {
+        this->table.flags[seat][hand] |= HAND_SOFT;
+    }
+    else
+    {
+        this->table.flags[seat][hand] &= ~HAND_SOFT;
+    }
+} // end of scoreHand
+
+//---------------------------------clearHands-----------------------------------
+//Description: Private function that destroys the cards of every hand of a seat
+//             and leaves it a single empty hand for the next round.
+//Parameters:  - seat: Index of the seat being cleared.
+//------------------------------------------------------------------------------
+void Game::clearHands(int seat)
+{
+    for (int h = 0; h < this->table.numHands[seat]; h++)
+    {
+        for (int i = 0; i < this->table.numCards[seat][h]; i++)
+        {
+            arena.destroy(this->table.cards[seat][h][i]);
+            this->table.cards[seat][h][i] = nullptr;
+        }
+        this->table.numCards[seat][h] = 0;
+        this->table.points[seat][h] = 0;
+        this->table.bets[seat][h] = 0;
+        this->table.flags[seat][h] = 0;
+    }
+    this->table.numHands[seat] = 1;
+    this->table.activeHand[seat] = 0;
+} // end of clearHands
+
+//----------------------------------nextHand------------------------------------
+//Description: Private function that moves a seat on to its next hand once the
+//             active one is finished. Returns false if it was the last hand.
+//Parameters:  - seat: Index of the seat.
+//------------------------------------------------------------------------------
+bool Game::nextHand(int seat)
+{
+    if (this->table.activeHand[seat] + 1 < this->table.numHands[seat])
+    {
+        this->table.activeHand[seat]++;
+        return true;
+    }
+    return false;
+} // end of nextHand
+
+//----------------------------------canSplit------------------------------------
+//Description: Private function that returns true if a seat's active hand is a
+//             pair, two cards of the same face or both worth 10, and the seat
+//             has room for another hand.
+//Parameters:  - seat: Index of the seat.
+//------------------------------------------------------------------------------
+bool Game::canSplit(int seat) const
+{
+    int hand = this->table.activeHand[seat];
+    if (this->table.numHands[seat] >= MAX_HANDS || this->table.numCards[seat][hand] != 2)
+    {
+        return false;
+    }
+    Card* first = this->table.cards[seat][hand][0];
+    Card* second = this->table.cards[seat][hand][1];
+    return first->getFace() == second->getFace()
+        || (first->getFace() != "A" && second->getFace() != "A" && first->getValue() == 10 && second->getValue() == 10);
+} // end of canSplit
+
+//--------------------------------canDoubleDown---------------------------------
+//Description: Private function that returns whether or not a seat may double
+//             down on its active hand: only as the first action on the hand's
+//             two cards, the player's balance has to cover more of the bet,
+//             and a split hand may only double if the table's rules allow it.
+//Parameters:  - seat: Index of the seat.
+//------------------------------------------------------------------------------
+bool Game::canDoubleDown(int seat) const
+{
+    int hand = this->table.activeHand[seat];
+    int extra = min(table.bets[seat][hand], seats[seat].getPlayer()->getBalance() - getTotalBet(seat));
+    return table.numCards[seat][hand] == 2 && extra > 0 && (table.numHands[seat] == 1 || rules.doubleAfterSplit);
+} // end of canDoubleDown
+
+//--------------------------------canSurrender----------------------------------
+//Description: Private function that returns whether or not a seat may
+//             surrender its active hand; with late surrender only as the first
+//             action on an unsplit hand.
+//Parameters:  - seat: Index of the seat.
+//------------------------------------------------------------------------------
+bool Game::canSurrender(int seat) const
+{
+    int hand = this->table.activeHand[seat];
+    return !rules.lateSurrender || (table.numCards[seat][hand] <= 2 && table.numHands[seat] == 1);
+} // end of canSurrender
+
+//-----------------------------------refuse-------------------------------------
+//Description: Private function that marks the action being taken as refused,
+//             and returns true as the player keeps their turn to choose again.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+bool Game::refuse()
+{
+    this->refused = true;
+    return true;
+} // end of refuse
+
+//--------------------------------getTotalBet-----------------------------------
+//Description: Private function that returns the amount bet on every hand of a
+//             seat, which the Player's balance has to cover.
+//Parameters:  - seat: Index of the seat.
+//------------------------------------------------------------------------------
+int Game::getTotalBet(int seat) const
+{
+    int total = 0;
+    for (int h = 0; h < this->table.numHands[seat]; h++)
+    {
+        total += this->table.bets[seat][h];
+    }
+    return total;
+} // end of getTotalBet
+
 //------------------------------updateDealerCards-------------------------------
 //Description: Private function that updates the dealer's card values when the
 //             dealer's hand is saved from BUST by changing the value of an Ace.
@@ -114,7 +397,7 @@ void Game::initializeSeats()
 void Game::updateDealerCards()
 {
     this->dealerPoints = 0;
-    for (int i = 0; i < this->dealerHand.size(); i++)
+    for (size_t i = 0; i < this->dealerHand.size(); i++)
     {
         this->dealerPoints += dealerHand[i]->getValue();
     }
@@ -123,8 +406,8 @@ void Game::updateDealerCards()
 //----------------------------------bustCheck-----------------------------------
 //Description: Public function that checks if the player or dealer has Bust.
 //             Receives a username of the player and a boolean if the check is
-//             for a dealer instead of a player. Returns true if the player or
-//             dealer has Bust, and false if not.
+//             for a dealer instead of a player. Returns true if the player's
+//             active hand or the dealer has Bust, and false if not.
 //Parameters:  - username: Player for whom the bust check will occur.
 //             - dealer:   Flag indicating whether or not the dealer is being
 //                         checked; true = yes, false = no.
@@ -135,7 +418,7 @@ bool Game::bustCheck(string username, bool dealer)
     {
         if (dealerPoints > 21)
         {
-            for (int i = 0; i < dealerHand.size(); i++)
+            for (size_t i = 0; i < dealerHand.size(); i++)
             {
                 if (dealerHand[i]->getFace() == "A" && dealerHand[i]->getValue() == 11)
                 {
@@ -148,30 +431,9 @@ bool Game::bustCheck(string username, bool dealer)
         }
     }
     else
-    {
-        for (int i = 0; i < DEFAULT_NUM_SEATS; i++)
-        {
-            if (seats[i]->isSeated())
-            {
-                if (seats[i]->getPlayer()->getName() == username)
-                {
-                    if (seats[i]->getPlayer()->getPoints() > 21)
-                    {
-                        vector<Card*> tempHand(seats[i]->getPlayer()->getHand());
-                        for (int j = 0; j < tempHand.size(); j++)
-                        {
-                            if (tempHand[j]->getFace() == "A" && tempHand[j]->getValue() == 11)
-                            {
-                                seats[i]->getPlayer()->getHand()[j]->setValue(1);
-                                seats[i]->getPlayer()->updateCardValues();
-                                return false;
-                            }
-                        }
-                        return true;
-                    }
-                }
-            }
-        }
+    { //The table already counts Aces as 1 where 11 would BUST
+        int seat = findSeat(username);
+        return seat >= 0 && table.points[seat][table.activeHand[seat]] > BLACKJACK;
     }
     return false;
 } // end of bustCheck
@@ -186,8 +448,7 @@ void Game::startRound()
     this->roundNum++;
     for (int i = 0; i < DEFAULT_NUM_SEATS; i++) // Reset all round and turn variables/states
     {
-        seats[i]->setBust(false);
-        seats[i]->setSurrender(false);
+        table.flags[i][table.activeHand[i]] &= ~(HAND_BUST | HAND_SURRENDERED);
     }
     dealCards();
 } // end of startRound
@@ -207,30 +468,112 @@ bool Game::dealCards()
     }
     if (this->shoe->getTotalCards() <= 52) //If there is one deck or less in the shoe
     {
-        cerr << "Dealer:\nLow on cards... emptying shoe and dealing another " << DEFAULT_DECK_SIZE << " decks.\n" << endl;
+        cerr << "Dealer:\nLow on cards... emptying shoe and dealing another " << rules.decks << " decks.\n" << endl;
         this->shoe->emptyDeck();
-        for (int i = 0; i < DEFAULT_DECK_SIZE; i++)
+        for (int i = 0; i < rules.decks; i++)
         {
             this->shoe->makeDeck();
         }
     }
+    beginRecord();
     for (int i = 0; i < DEFAULT_NUM_SEATS; i++)
     {
-        if (seats[i]->isSeated()) //added
+        if (seats[i].isSeated()) //added
         {
-            this->seats[i]->getPlayer()->addCard(this->shoe->drawCard(true));
-            this->seats[i]->getPlayer()->addCard(this->shoe->drawCard(true));
-            if (bustCheck(seats[i]->getPlayer()->getName(), false) == true)
-            {
-                seats[i]->setBust(true);
-            }
+            addCard(i, drawCard(true, i, table.activeHand[i]));
+            addCard(i, drawCard(true, i, table.activeHand[i]));
         }
     }
-    this->dealerHand.push_back(this->shoe->drawCard(true));
-    this->dealerHand.push_back(this->shoe->drawCard(false));
+    this->dealerHand.push_back(drawCard(true, HISTORY_DEALER, 0));
+    this->dealerHand.push_back(drawCard(false, HISTORY_DEALER, 0));
     bustCheck("dealer", true);
+    return true;
 } // end of dealCards
 
+//----------------------------------drawCard------------------------------------
+//Description: Private function that draws the top Card of the shoe into the
+//             round's Arena and records who it is dealt to.
+//Parameters:  - visible: Flag for whether or not the Card is dealt face up.
+//             - seat:    Seat the Card is dealt to, or HISTORY_DEALER.
+//             - hand:    Hand at the seat the Card is dealt to.
+//------------------------------------------------------------------------------
+Card* Game::drawCard(bool visible, int seat, int hand)
+{
+    Card* card = arena.create<Card>(this->shoe->drawCard(visible));
+    if (recording)
+    {
+        record.addEvent(HistoryAction::DEAL, seat, hand, encodeCard(*card), visible);
+    }
+    return card;
+} // end of drawCard
+
+//----------------------------------logEvent------------------------------------
+//Description: Private function that records an action at a seat for the hand
+//             history, if the table keeps one.
+//Parameters:  - action: What happened.
+//             - seat:   Seat it happened at.
+//             - hand:   Hand at the seat.
+//             - amount: Depends on the action, see HistoryAction.
+//------------------------------------------------------------------------------
+void Game::logEvent(HistoryAction action, int seat, int hand, int amount)
+{
+    if (recording)
+    {
+        record.addEvent(action, seat, hand, HISTORY_NO_CARD, amount);
+    }
+} // end of logEvent
+
+//--------------------------------beginRecord-----------------------------------
+//Description: Private function that starts the round's record for the hand
+//             history with the players seated, the balance of those who sat
+//             down since the last round, and the bets already placed, before
+//             any card is dealt.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+void Game::beginRecord()
+{
+    if (!recording)
+    {
+        return;
+    }
+    record.begin(this->gameID, this->roundNum, this->shoe->getTotalCards(), rules, this->seed);
+    for (int i = 0; i < DEFAULT_NUM_SEATS; i++)
+    {
+        if (seats[i].isSeated())
+        {
+            record.setName(i, seats[i].getPlayer()->getName());
+            if (joined[i])
+            {
+                logEvent(HistoryAction::SIT, i, table.activeHand[i], seats[i].getPlayer()->getBalance());
+                joined[i] = false;
+            }
+            if (table.bets[i][table.activeHand[i]] > 0)
+            {
+                logEvent(HistoryAction::BET, i, table.activeHand[i], table.bets[i][table.activeHand[i]]);
+            }
+        }
+    }
+} // end of beginRecord
+
+//---------------------------------endRecord------------------------------------
+//Description: Private function that finishes the round's record once bets are
+//             settled and hands it to the hand history, if the table keeps one.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+void Game::endRecord()
+{
+    if (!record.isRecording())
+    {
+        return;
+    }
+    const char* bytes;
+    size_t size = record.finish(&bytes);
+    if (history != nullptr)
+    {
+        history->append(bytes, size);
+    }
+} // end of endRecord
+
 //----------------------------------placeBet------------------------------------
 //Description: Public function that allows players to place their bet at the
 //             beginning of the round. Returns the amount of the bet if the
@@ -246,130 +589,279 @@ int Game::placeBet(string username, int amount)
     {
         return -1;
     }
-    for (int i = 0; i < DEFAULT_NUM_SEATS; i++)
+    int seat = findSeat(username);
+    if (seat >= 0)
     {
-        if (seats[i]->isSeated())
+        if (seats[seat].getPlayer()->getBalance() - amount < 0)
         {
-            if (seats[i]->getPlayer()->getName() == username)
-            {
-                if (seats[i]->getPlayer()->getBalance() - amount < 0)
-                {
-                    return seats[i]->getPlayer()->getBalance();
-                } 
-                seats[i]->setBet(amount);
-                return amount;
-            }
+            return seats[seat].getPlayer()->getBalance();
+        } 
+        table.bets[seat][table.activeHand[seat]] = amount;
+        if (record.isRecording())
+        { //Bet after the cards were dealt
+            logEvent(HistoryAction::BET, seat, table.activeHand[seat], amount);
         }
+        return amount;
     }
     return -1;
 } // end of placeBet
 
 //-------------------------------------hit--------------------------------------
 //Description: Public function for a player to hit, or get dealt an additional
-//             card.
+//             card on their active hand. Returns true while the player has a
+//             hand left to play, moving on to their next hand if this one Bust.
 //Parameters:  - username: The player who is receiving the card.
 //------------------------------------------------------------------------------
 bool Game::hit(string username)
 {
-    for (int i = 0; i < DEFAULT_NUM_SEATS; i++)
+    this->refused = false;
+    int seat = findSeat(username);
+    if (seat < 0)
     {
-        if (seats[i]->isSeated())
-        {
-            if (seats[i]->getPlayer()->getName() == username)
-            {
-                if (seats[i]->hasBust() == true)
-                {
-                    return false;
-                }
-                this->seats[i]->getPlayer()->addCard(this->shoe->drawCard(true));
-                if (bustCheck(username, false) == true)
-                {
-                    seats[i]->setBust(true);
-                    return false;
-                }
-            }
-        }
+        return refuse();
+    }
+    unsigned char &flags = table.flags[seat][table.activeHand[seat]];
+    if (flags & HAND_BUST)
+    {
+        return nextHand(seat);
+    }
+    logEvent(HistoryAction::HIT, seat, table.activeHand[seat]);
+    addCard(seat, drawCard(true, seat, table.activeHand[seat]));
+    if (bustCheck(username, false) == true)
+    {
+        flags |= HAND_BUST;
+        return nextHand(seat);
     }
     return true;
 } // end of hit
 
+//------------------------------------stand-------------------------------------
+//Description: Public function for a player to stand on their active hand.
+//             Returns true if the player has another split hand to play.
+//Parameters:  - username: The player who is standing.
+//------------------------------------------------------------------------------
+bool Game::stand(string username)
+{
+    this->refused = false;
+    int seat = findSeat(username);
+    if (seat < 0)
+    {
+        return false;
+    }
+    logEvent(HistoryAction::STAND, seat, table.activeHand[seat]);
+    return nextHand(seat);
+} // end of stand
+
+//------------------------------------split-------------------------------------
+//Description: Public function to split a pair into two hands, each with the
+//             original bet and dealt one more card, played one after the
+//             other. The pair stays as it is if it can't be split again or
+//             the player's balance can't cover another bet. Returns true as
+//             the player keeps their turn either way.
+//Parameters:  - username: Player who is splitting.
+//------------------------------------------------------------------------------
+bool Game::split(string username)
+{
+    this->refused = false;
+    int seat = findSeat(username);
+    if (seat < 0 || !canSplit(seat))
+    {
+        return refuse();
+    }
+    int hand = table.activeHand[seat];
+    if (seats[seat].getPlayer()->getBalance() < getTotalBet(seat) + table.bets[seat][hand])
+    {
+        return refuse();
+    }
+    int other = table.numHands[seat]++;
+    logEvent(HistoryAction::SPLIT, seat, other, hand);
+    table.numCards[seat][other] = 0;
+    table.cards[seat][other][table.numCards[seat][other]++] = table.cards[seat][hand][--table.numCards[seat][hand]];
+    table.bets[seat][other] = table.bets[seat][hand];
+    table.flags[seat][other] = HAND_SPLIT;
+    table.flags[seat][hand] |= HAND_SPLIT;
+    table.cards[seat][hand][table.numCards[seat][hand]++] = drawCard(true, seat, hand);
+    table.cards[seat][other][table.numCards[seat][other]++] = drawCard(true, seat, other);
+    scoreHand(seat, hand);
+    scoreHand(seat, other);
+    return true;
+} // end of split
+
 //----------------------------------surrender-----------------------------------
-//Description: Public function to surrender the player's hand.
+//Description: Public function to surrender the player's active hand. Returns
+//             true if the table's late surrender rule no longer allows it after
+//             the first action, or on a split hand, and the player keeps their
+//             turn; otherwise whether the player has another hand to play.
 //Parameters:  - username: Player who is surrendering.
 //------------------------------------------------------------------------------
 bool Game::surrender(string username)
 {
-    for (int i = 0; i < DEFAULT_NUM_SEATS; i++)
+    this->refused = false;
+    int seat = findSeat(username);
+    if (seat < 0)
     {
-        if (seats[i]->isSeated())
-        {
-            if (seats[i]->getPlayer()->getName() == username)
-            {
-                seats[i]->setSurrender(true);
-                seats[i]->getPlayer()->discardHand();
-            }
-        }
+        return false;
+    }
+    int hand = table.activeHand[seat];
+    if (!canSurrender(seat))
+    {
+        return refuse();
     }
+    table.flags[seat][hand] |= HAND_SURRENDERED;
+    logEvent(HistoryAction::SURRENDER, seat, hand);
+    return nextHand(seat);
 } // end of surrender
 
 //---------------------------------doubleDown-----------------------------------
 //Description: Public function to double down -- in other words, the player
-//             doubles their bet and only receives one additional card.
+//             doubles their bet and only receives one additional card, which
+//             ends the hand. A player short of the full amount doubles for what
+//             their balance still covers, and a split hand may only double where
+//             the table allows it. Returns true while the player has a hand
+//             left to play.
 //Parameters:  - username: Player who is doubling down.
 //------------------------------------------------------------------------------
 bool Game::doubleDown(string username)
 {
-    for (int i = 0; i < DEFAULT_NUM_SEATS; i++)
+    this->refused = false;
+    int seat = findSeat(username);
+    if (seat < 0)
+    {
+        return false;
+    }
+    if (!canDoubleDown(seat))
     {
-        if (seats[i]->isSeated())
+        return refuse();
+    }
+    int hand = table.activeHand[seat];
+    int extra = min(table.bets[seat][hand], seats[seat].getPlayer()->getBalance() - getTotalBet(seat));
+    table.bets[seat][hand] += extra;
+    table.flags[seat][hand] |= HAND_DOUBLED;
+    logEvent(HistoryAction::DOUBLE_DOWN, seat, hand, extra);
+    addCard(seat, drawCard(true, seat, hand));
+    if (bustCheck(username, false) == true)
+    {
+        table.flags[seat][hand] |= HAND_BUST;
+    }
+    return nextHand(seat);
+} // end of doubleDown
+
+//-------------------------------getRunningCount--------------------------------
+//Description: Public function that returns the running count of the cards
+//             dealt face up from the shoe.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+int Game::getRunningCount() const
+{
+    return this->shoe->getRunningCount();
+} // end of getRunningCount
+
+//--------------------------------getTrueCount----------------------------------
+//Description: Public function that returns the running count per deck not yet
+//             seen.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+double Game::getTrueCount() const
+{
+    return this->shoe->getTrueCount();
+} // end of getTrueCount
+
+//--------------------------------wasRefused------------------------------------
+//Description: Public function that returns whether or not the last action was
+//             refused, leaving the hand as it was.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+bool Game::wasRefused() const
+{
+    return this->refused;
+} // end of wasRefused
+
+//-----------------------------setCountingSystem--------------------------------
+//Description: Public function that switches the shoe's counting system.
+//Parameters:  - system: Counting system to use, e.g. HI_LO or KO.
+//------------------------------------------------------------------------------
+void Game::setCountingSystem(const CountingSystem &system)
+{
+    this->shoe->setCountingSystem(system);
+} // end of setCountingSystem
+
+//-------------------------------setRecording-----------------------------------
+//Description: Public function that chooses whether or not each round is
+//             recorded, without a hand history to hand the records to, so a
+//             replay can check them against the log. Takes effect from the next
+//             round.
+//Parameters:  - recording: Whether or not to record.
+//------------------------------------------------------------------------------
+void Game::setRecording(bool recording)
+{
+    this->recording = recording || history != nullptr;
+} // end of setRecording
+
+//------------------------------getBasicDecision--------------------------------
+//Description: Public function that returns the basic strategy action for the
+//             specified player's hand against the dealer's upcard, looked up in
+//             the chart in BasicStrategy.h. Used by the server's bot players.
+//Parameters:  - username: Player whose hand is being played.
+//------------------------------------------------------------------------------
+Decision Game::getBasicDecision(string username) const
+{
+    if (dealerHand.empty())
+    {
+        return Decision::STAND;
+    }
+    int upcard = dealerHand[0]->getValue() == 11 ? ACE : dealerHand[0]->getValue();
+    int seat = findSeat(username);
+    if (seat >= 0)
+    {
+        int hand = table.activeHand[seat];
+        if (table.flags[seat][hand] & (HAND_BUST | HAND_SURRENDERED))
         {
-            if (seats[i]->getPlayer()->getName() == username)
-            {
-                if (seats[i]->getPlayer()->getBalance() - (seats[i]->getBet() * 2) < 0)
-                {
-                    this->seats[i]->setBet(seats[i]->getPlayer()->getBalance());
-                    if (bustCheck(username, false) == true)
-                    {
-                        this->seats[i]->setBust(true);
-                    }
-                    return true;
-                }
-                else
-                {
-                    seats[i]->setBet(seats[i]->getBet() * 2);
-                    this->seats[i]->getPlayer()->addCard(this->shoe->drawCard(true));
-                    if (bustCheck(username, false) == true)
-                    {
-                        this->seats[i]->setBust(true);
-                    }
-                    return true;
-                }
-            }
+            return Decision::STAND;
         }
+        bool firstAction = table.numCards[seat][hand] == 2;
+        bool soft = (table.flags[seat][hand] & HAND_SOFT) != 0;
+        Decision decision = basicDecision(table.points[seat][hand], soft, upcard, firstAction);
+        if (decision == Decision::DOUBLE_DOWN && !canDoubleDown(seat))
+        {
+            return Decision::HIT; //Can't cover the double, or no double after split
+        }
+        if (decision == Decision::SURRENDER && !canSurrender(seat))
+        {
+            return Decision::HIT; //Too late to surrender, the chart's rows are for surrender any time
+        }
+        return decision;
     }
-    return false;
-} // end of doubleDown
+    return Decision::STAND;
+} // end of getBasicDecision
 
 //-------------------------------dealerActions----------------------------------
 //Description: Public fuunction to trigger dealer behavior of checking if players
 //             have bust or if the dealer drew a natural or a blackjack. If not,
-//             or if the dealer has less than 17 cards, it will hit until it doesn't.
+//             or if the dealer has less than 17 cards (or a soft 17 where the
+//             table's rules hit it), it will hit until it doesn't.
 //Parameters:  N/A
 //------------------------------------------------------------------------------
 bool Game::dealerActions()
 {
     //Flip invisible card
     this->dealerHand[1]->flip();
+    this->shoe->revealCard(this->dealerHand[1]);
     //Assess dealer card values
-    for (int i = 0; i < dealerHand.size(); i++)
+    for (size_t i = 0; i < dealerHand.size(); i++)
     {
         dealerPoints += dealerHand[i]->getValue();
     }
+    bustCheck("dealer", true); //A pair of Aces counts one as 1
     //Check if all players have bust
     int bustCount = 0;
     for (int i = 0; i < DEFAULT_NUM_SEATS; i++)
     {
-        if (seats[i]->isSeated() == true && seats[i]->hasBust() == true)
+        bool allBust = seats[i].isSeated();
+        for (int h = 0; h < table.numHands[i] && allBust; h++)
+        {
+            allBust = (table.flags[i][h] & HAND_BUST) != 0;
+        }
+        if (allBust == true)
         {
             bustCount++;
         }
@@ -384,9 +876,9 @@ bool Game::dealerActions()
         { //If all Players have bust, don't bother hitting
             return true;
         } 
-        while (dealerPoints < 17) //Hit
+        while (dealerHits()) //Hit
         { //Keep hitting until point value of cards is >= 17
-            this->dealerHand.push_back(this->shoe->drawCard(true));
+            this->dealerHand.push_back(drawCard(true, HISTORY_DEALER, 0));
             this->dealerPoints += this->dealerHand[dealerHand.size() - 1]->getValue();
             if (bustCheck("dealer", true) == true)
             { //If the dealer busts, settle up
@@ -398,43 +890,113 @@ bool Game::dealerActions()
     return true;
 } // end of dealerActions
 
+//--------------------------------dealerHits------------------------------------
+//Description: Private function that returns true if the dealer draws to its
+//             current total: below 17, or a soft 17 if the table hits it.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+bool Game::dealerHits() const
+{
+    if (dealerPoints < DEALER_STAND)
+    {
+        return true;
+    }
+    bool soft = false;
+    for (size_t i = 0; i < dealerHand.size(); i++)
+    {
+        if (dealerHand[i]->getFace() == "A" && dealerHand[i]->getValue() == 11)
+        {
+            soft = true;
+        }
+    }
+    return rules.hitSoft17 && soft && dealerPoints == DEALER_STAND;
+} // end of dealerHits
+
+//-------------------------------dealerNatural----------------------------------
+//Description: Private function that returns true if the dealer's first two
+//             cards make 21.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+bool Game::dealerNatural() const
+{
+    return dealerHand.size() == 2 && dealerPoints == 21;
+} // end of dealerNatural
+
 //--------------------------------settleBets------------------------------------
 //Description: Public function to settle the bets after the dealer has finished
-//             its turn and the round has concluded.
+//             its turn and the round has concluded. A winning natural pays at
+//             the table's rate, and under late surrender a hand surrendered
+//             against a dealer natural loses the whole bet. Each split hand is
+//             settled on its own bet. Each seated player's record is posted to
+//             the ledger. Once every hand is discarded the round's Arena is
+//             reset and its record goes to the hand history, and the round
+//             waits for the ledger to sync its posts, with those of any other
+//             table settling meanwhile.
 //Parameters:  N/A
 //------------------------------------------------------------------------------
 bool Game::settleBets()
 {
+    unsigned long long posted = 0;
     for (int i = 0; i < DEFAULT_NUM_SEATS; i++)
     {
-        if (this->seats[i]->isSeated())
+        if (this->seats[i].isSeated())
         {
-            if (this->seats[i]->getPlayer()->getPoints() == this->dealerPoints && this->seats[i]->hasBust() == false)
-            { // Push -- player gets back their bet
-                //Do nothing, player keeps their bet, set bet to 0, leave balance alone
-            }
-            else if ((this->seats[i]->getPlayer()->getPoints() > this->dealerPoints && this->seats[i]->hasBust() == false) || this->dealerPoints > 21 && this->seats[i]->hasBust() == false)
-            { // Player wins, pay out bet amount to balance
-                //Pay out player the amount of their bet, set bet to 0, add bet amount to balance
-                seats[i]->getPlayer()->addBalance(seats[i]->getBet());
-                seats[i]->getPlayer()->addWin();
-            }
-            else if (this->seats[i]->hasSurrended() == true)
-            { // Player surrenders and loses half of their bet
-                seats[i]->getPlayer()->removeBalance(seats[i]->getBet()/2);
-                seats[i]->getPlayer()->addLoss();
+            Player* player = seats[i].getPlayer();
+            const int* bets = table.bets[i];
+            const int* points = table.points[i];
+            const unsigned char* flags = table.flags[i];
+            for (int h = 0; h < table.numHands[i]; h++)
+            {
+                int balance = player->getBalance();
+                bool bust = (flags[h] & HAND_BUST) != 0;
+                if ((flags[h] & HAND_SURRENDERED) && rules.lateSurrender && dealerNatural())
+                { // Too late, the dealer's natural takes the whole bet
+                    player->removeBalance(bets[h]);
+                    player->addLoss();
+                }
+                else if (flags[h] & HAND_SURRENDERED)
+                { // Player surrenders and loses half of their bet
+                    player->removeBalance(bets[h]/2);
+                    player->addLoss();
+                }
+                else if (points[h] == this->dealerPoints && bust == false)
+                { // Push -- player gets back their bet
+                    //Do nothing, player keeps their bet, leave balance alone
+                }
+                else if ((points[h] > this->dealerPoints && bust == false) || this->dealerPoints > 21 && bust == false)
+                { // Player wins, pay out bet amount to balance
+                    if (table.numCards[i][h] == 2 && points[h] == 21 && !(flags[h] & HAND_SPLIT))
+                    { //Natural, paid at the table's rate; 21 on a split hand is not a natural
+                        player->addBalance(bets[h] * rules.naturalPays / rules.naturalPer);
+                    }
+                    else
+                    {
+                        player->addBalance(bets[h]);
+                    }
+                    player->addWin();
+                }
+                else
+                { // Player has bust or has less points than the dealer and loses their bet from balance
+                    player->removeBalance(bets[h]);
+                    player->addLoss();
+                }
+                logEvent(HistoryAction::SETTLE, i, h, player->getBalance() - balance);
             }
-            else
-            { // Player has bust or has less points than the dealer and loses their bet from balance
-                //Player loses their bet, set bet to 0, subtract bet amount from balance
-                seats[i]->getPlayer()->removeBalance(seats[i]->getBet());
-                seats[i]->getPlayer()->addLoss();
+            if (ledger != nullptr)
+            {
+                posted = ledger->post(*player);
             }
-            seats[i]->getPlayer()->discardHand(); //Discard cards in hand; reset points to 0
-            seats[i]->setBet(0);
         }
+        clearHands(i); //Discard cards in every hand; reset points and bets to 0
     }
     discardHand();
+    arena.reset(); //Every Card dealt this round has been destroyed
+    endRecord();
+    if (posted > 0)
+    {
+        return ledger->sync(posted);
+    }
+    return true;
 } // end of settleBets
 
 //--------------------------------discardHand-----------------------------------
@@ -446,77 +1008,184 @@ bool Game::discardHand()
 {
   if (!dealerHand.empty())
   {
-    for (int i = 0; i < dealerHand.size(); i++)
+    for (size_t i = 0; i < dealerHand.size(); i++)
     {
-      delete dealerHand[i];
+      arena.destroy(dealerHand[i]);
       dealerHand[i] = nullptr;
     }
     dealerHand.clear();
   }
   this->dealerPoints = 0;
+  return true;
 } // end of discardHand
 
+//---------------------------------getGameID------------------------------------
+//Description: Public function that returns the ID number of the game.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+int Game::getGameID() const
+{
+    return this->gameID;
+} // end of getGameID
+
+//---------------------------------getRules-------------------------------------
+//Description: Public function that returns the rules the table is played by.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+const TableRules &Game::getRules() const
+{
+    return this->rules;
+} // end of getRules
+
+//---------------------------------getSeed--------------------------------------
+//Description: Public function that returns the seed the shoe is shuffled from.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+unsigned long long Game::getSeed() const
+{
+    return this->seed;
+} // end of getSeed
+
+//-------------------------------getLastRecord----------------------------------
+//Description: Public function that returns the size of the record of the last
+//             round settled and points to it, valid until the next round is
+//             dealt, or 0 if rounds aren't recorded.
+//Parameters:  - record: Set to the start of the record.
+//------------------------------------------------------------------------------
+size_t Game::getLastRecord(const char** record) const
+{
+    return this->record.getFinished(record);
+} // end of getLastRecord
+
+//--------------------------------writeImage------------------------------------
+//Description: Public function that writes the Game to a snapshot image between
+//             rounds: its ID, seed, round number and rules, the record of the
+//             player at each seat and the shoe.
+//Parameters:  - image: Snapshot image to write to.
+//------------------------------------------------------------------------------
+void Game::writeImage(SnapshotWriter &image) const
+{
+    image.put<int32_t>(this->gameID);
+    image.put<uint64_t>(this->seed);
+    image.put<int32_t>(this->roundNum);
+    image.putString(rules.name);
+    for (int i = 0; i < DEFAULT_NUM_SEATS; i++)
+    {
+        image.put<uint8_t>(seats[i].isSeated());
+        if (seats[i].isSeated())
+        {
+            const Player* player = seats[i].getPlayer();
+            image.putString(player->getName());
+            image.put<int32_t>(player->getBalance());
+            image.put<int32_t>(player->getWins());
+            image.put<int32_t>(player->getLosses());
+        }
+    }
+    this->shoe->writeImage(image);
+} // end of writeImage
+
+//---------------------------------templates------------------------------------
+//Lines of the hands and scoreboard that never change, written as they were
+//laid out with setw.
+//------------------------------------------------------------------------------
+static const char HANDS_HEADER[] = "\t\t      Hands\n"
+    "___________________________________________________\n";
+static const char HANDS_FOOTER[] = "\n___________________________________________________\n\n";
+static const char STATS_RULE[] = "+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++\n";
+static const char STATS_FIRST_ROUND[] = "|                                Starting Round 1                               |\n";
+static const char STATS_ROUND[] = "|                                  Round ";
+static const char STATS_ROUND_END[] = "                                      |\n";
+static const char STATS_COLUMNS[] = "|          Player           |     Balance     |      Wins      |     Losses     |\n"
+    "---------------------------------------------------------------------------------\n";
+static const char STATS_BALANCE[] = "                     $";
+
 //--------------------------------displayCards----------------------------------
 //Description: Public function to display the cards of every player active in the
-//             game as well as the dealer.
+//             game, one line per split hand, as well as the dealer.
 //Parameters:  N/A
 //------------------------------------------------------------------------------
 string Game::displayCards() const
 {
-    stringstream ss;
-    ss << "\t\t      Hands" << endl;
-    ss << "___________________________________________________" << endl;
+    Renderer out;
+    writeCards(out);
+    return out.str();
+} // end of displayCards
+
+//---------------------------------renderCards----------------------------------
+//Description: Public function that renders what displayCards returns into the
+//             table's Renderer, without allocating. The text is valid until
+//             the next render.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+const Renderer &Game::renderCards()
+{
+    this->text.clear();
+    writeCards(this->text);
+    return this->text;
+} // end of renderCards
+
+//---------------------------------writeCards-----------------------------------
+//Description: Private function that writes the cards of every player active in
+//             the game, one line per split hand, as well as the dealer.
+//Parameters:  - out: Renderer the text is written to.
+//------------------------------------------------------------------------------
+void Game::writeCards(Renderer &out) const
+{
+    out.append(HANDS_HEADER, sizeof(HANDS_HEADER) - 1);
     for (int i = 0; i < DEFAULT_NUM_SEATS; i++)
     {
-        if (seats[i]->isSeated())
+        if (seats[i].isSeated())
         {
-            ss << seats[i]->getPlayer()->getName() << " (Bet: $" << seats[i]->getBet() << ") " << endl;
-            if (seats[i]->isSeated() == true)
+            for (int h = 0; h < table.numHands[i]; h++)
             {
-                vector<Card*> tempHand(seats[i]->getPlayer()->getHand());
-                for (int j = 0; j < tempHand.size(); j++)
+                out.append(seats[i].getPlayer()->getName());
+                out.append(" (Bet: $");
+                out.append(table.bets[i][h]);
+                out.append(") \n");
+                for (int j = 0; j < table.numCards[i][h]; j++)
                 {
-                    ss << *tempHand[j] << " ";
+                    out.append(*table.cards[i][h][j]);
+                    out.append(" ", 1);
                 }
-                if (seats[i]->hasBust() == true)
+                if (table.flags[i][h] & HAND_BUST)
                 {
-                    ss << "-- BUST";
+                    out.append("-- BUST");
                 }
-                if (seats[i]->getPlayer()->getPoints() == 21)
+                if (table.points[i][h] == 21)
                 {
-                    ss << "-- BLACKJACK";
+                    out.append("-- BLACKJACK");
                 }
-                if (seats[i]->hasSurrended() == true)
+                if (table.flags[i][h] & HAND_SURRENDERED)
                 {
-                    ss << "SURRENDERED";
+                    out.append("SURRENDERED");
                 }
-                ss << "\n" << endl;
+                out.append("\n\n", 2);
             }
         }
     }
-    ss << "Dealer" << endl;
-    for (int k = 0; k < dealerHand.size(); k++)
+    out.append("Dealer\n");
+    for (size_t k = 0; k < dealerHand.size(); k++)
     {
         if (dealerHand[k]->isVisible() == false)
         {
-            ss << "[    ]";
+            out.append("[    ]");
         }
         else
         {
-            ss << *dealerHand[k] << " ";   
+            out.append(*dealerHand[k]);
+            out.append(" ", 1);
         }
     }
     if (dealerPoints > 21)
     {
-        ss << "-- BUST";
+        out.append("-- BUST");
     }
     if (dealerPoints == 21)
     {
-        ss << "-- BLACKJACK";
+        out.append("-- BLACKJACK");
     }
-    ss << "\n___________________________________________________\n" << endl;
-    return ss.str();
-} // end of displayCards
+    out.append(HANDS_FOOTER, sizeof(HANDS_FOOTER) - 1);
+} // end of writeCards
 
 //---------------------------------printStats-----------------------------------
 //Description: Public function to print the scoreboard; generally done at the
@@ -525,27 +1194,56 @@ string Game::displayCards() const
 //------------------------------------------------------------------------------
 string Game::printStats() const
 {
-    stringstream ss;
-    ss << "+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++\n";
+    Renderer out;
+    writeStats(out);
+    return out.str();
+} // end of printStats
+
+//---------------------------------renderStats----------------------------------
+//Description: Public function that renders what printStats returns into the
+//             table's Renderer, without allocating. The text is valid until
+//             the next render.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+const Renderer &Game::renderStats()
+{
+    this->text.clear();
+    writeStats(this->text);
+    return this->text;
+} // end of renderStats
+
+//---------------------------------writeStats-----------------------------------
+//Description: Private function that writes the scoreboard, one row per player
+//             laid out as the Player's output operator does.
+//Parameters:  - out: Renderer the text is written to.
+//------------------------------------------------------------------------------
+void Game::writeStats(Renderer &out) const
+{
+    out.append(STATS_RULE, sizeof(STATS_RULE) - 1);
     if (roundNum == 0)
     {
-        ss << "|" << setw(48) << "Starting Round 1" << setw(33) << "|\n";
+        out.append(STATS_FIRST_ROUND, sizeof(STATS_FIRST_ROUND) - 1);
     }
     else
     {
-        ss << "|" << setw(40) << "Round " << this->roundNum << setw(40) << "|\n";
+        out.append(STATS_ROUND, sizeof(STATS_ROUND) - 1);
+        out.append(this->roundNum);
+        out.append(STATS_ROUND_END, sizeof(STATS_ROUND_END) - 1);
     }
-    ss << "+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++\n";
-    ss << "|" << setw(16) << "Player" << setw(12) << "|" << setw(12) << "Balance" << setw(6); 
-    ss << "|" << setw(10) << "Wins"<< setw(7) << "|" << setw(11) << "Losses" << setw(7) << "|\n";
-    ss << "---------------------------------------------------------------------------------\n";
+    out.append(STATS_RULE, sizeof(STATS_RULE) - 1);
+    out.append(STATS_COLUMNS, sizeof(STATS_COLUMNS) - 1);
     for (int i = 0; i < DEFAULT_NUM_SEATS; i++)
     {
-        if (seats[i]->isSeated() == true)
+        if (seats[i].isSeated() == true)
         {
-            ss << *seats[i]->getPlayer();
+            const Player* player = seats[i].getPlayer();
+            out.appendPadded(player->getName(), 15);
+            out.append(STATS_BALANCE, sizeof(STATS_BALANCE) - 1);
+            out.append(player->getBalance());
+            out.appendPadded(player->getWins(), 16);
+            out.appendPadded(player->getLosses(), 18);
+            out.append("\n", 1);
         }
     }
-    ss << "+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++\n";
-    return ss.str();
-} // end of printStats
\ No newline at end of file
+    out.append(STATS_RULE, sizeof(STATS_RULE) - 1);
+} // end of writeStats
\ No newline at end of file
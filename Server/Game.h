@@ -3,14 +3,15 @@
 //Team: LuckyNo13
 //Description: This is the header file for the Game class. It is the controller
 //             class that aggregates all other objects in the game. It contains
-//             a vector for Seats, a Deck called a shoe that contains all the 
+//             an array of Seats, a Deck called a shoe that contains all the 
 //             Card objects currently in play, a flag for whether or not the
 //             round is active, values for the game's ID, how many total Players
 //             and active Players, the round number, and private functions to
 //             discard the dealer's hand, update the dealer's Cards point values,
 //             and initialize the Seats when the game starts. It exposes functions
-//             to retrieve and modify those attributes. The class is used within
-//             a driver file and is created by a driver.
+//             to retrieve and modify those attributes. Each table plays by its
+//             own TableRules and keeps its hands in a TableState. The class is
+//             used within a driver file and is created by a driver.
 //------------------------------------------------------------------------------
 #ifndef GAME_H
 #define GAME_H
@@ -18,55 +19,132 @@
 #include <string>
 #include <vector>
 #include <array>
+#include <algorithm>
 #include <sstream>
 #include <unistd.h>
 #include <iomanip>
+#include <chrono>
 #include "Deck.h"
+#include "Arena.h"
+#include "Renderer.h"
+#include "HandHistory.h"
+#include "Ledger.h"
 #include "Player.h"
 #include "card.h"
 #include "Seat.h"
+#include "PlayerPool.h"
+#include "Rules.h"
+#include "BasicStrategy.h"
 using namespace std;
 
-static const int DEFAULT_DECK_SIZE = 4; //Number of decks of cards
+static const int DEFAULT_DECK_SIZE = HouseRules::DECKS; //Number of decks of cards
 static const int DEFAULT_NUM_SEATS = 4; //Number of seats at table
 static const int MINIMUM_BET = 2;       //Minimum dollar amount for bets
 static const int MAXIMUM_BET = 10;      //Maximum dollar amount for bets
+static const int MAX_HANDS = 4;                     //Most hands a Seat plays after re-splitting
+static const int MAX_HAND_CARDS = BLACKJACK + 1;    //Most cards a hand can hold: 21 Aces and the card that BUSTs
+static const unsigned long long CLOCK_SEED = 0;     //Seed a Game is given to shuffle from the clock instead
+
+//Flags kept for each hand in TableState::flags
+static const unsigned char HAND_BUST = 1;           //The hand has bust
+static const unsigned char HAND_SURRENDERED = 2;    //The hand was surrendered
+static const unsigned char HAND_DOUBLED = 4;        //The hand doubled down
+static const unsigned char HAND_SPLIT = 8;          //The hand came from a split
+static const unsigned char HAND_SOFT = 16;          //The hand counts an Ace as 11
+
+struct TableState
+{
+    int numHands[DEFAULT_NUM_SEATS];                            //Number of hands each Seat plays this round
+    int activeHand[DEFAULT_NUM_SEATS];                          //Index of the hand each Seat is playing
+    int bets[DEFAULT_NUM_SEATS][MAX_HANDS];                     //Amount bet on each hand
+    int points[DEFAULT_NUM_SEATS][MAX_HANDS];                   //Points of each hand, Aces counted as 11 unless that BUSTs
+    unsigned char flags[DEFAULT_NUM_SEATS][MAX_HANDS];          //HAND_ flags of each hand
+    int numCards[DEFAULT_NUM_SEATS][MAX_HANDS];                 //Number of cards in each hand
+    Card* cards[DEFAULT_NUM_SEATS][MAX_HANDS][MAX_HAND_CARDS];  //Cards of each hand in the order dealt
+};
 
 class Game
 {
     private:
-        Seat* seats[DEFAULT_NUM_SEATS];     //Array for seat objects holding players
+        Seat seats[DEFAULT_NUM_SEATS];      //Array for seat objects holding players
+        TableState table;                   //Hands played from every seat this round
         vector<Card*> dealerHand;           //Vector containing dealer's current hand
         Deck *shoe;                         //A cumulative deck for the shoe (card dispenser)
+        unsigned long long seed;            //Seed the shoe is shuffled from
         int dealerPoints;                   //The sum of points of the card values for dealer
         int gameID;                         //The ID number for the game
         int totalPlayers;                   //Number of total players in the game
         int scores[4];                      //Array for keeping scores of players
         int roundNum;                       //The number of the current round
+        TableRules rules;                   //Rules this table is played by
+        Arena arena;                        //Memory for the Cards dealt this round, reset as bets are settled
+        PlayerPool* pool;                   //Server's player records, or nullptr to start every player afresh
+        Renderer text;                      //Buffer the hands and scoreboard are rendered into
+        HandHistory* history;               //Server's hand history log, or nullptr to keep no history
+        Ledger* ledger;                     //Server's player ledger, or nullptr to keep no ledger
+        RoundRecord record;                 //Everything that happened this round, for the history
+        bool recording;                     //Whether or not each round is recorded, for the history or a replay
+        bool joined[DEFAULT_NUM_SEATS];     //Whether or not each Seat's player sat down since the last round recorded
+        bool refused;                       //Whether or not the last action was refused and changed nothing
         bool discardHand();
+        bool dealerHits() const;
+        bool dealerNatural() const;
         void initializeSeats();
+        int findSeat(const string &username) const;
+        void addCard(int seat, Card* card);
+        void scoreHand(int seat, int hand);
+        void clearHands(int seat);
+        bool nextHand(int seat);
+        bool canSplit(int seat) const;
+        bool canDoubleDown(int seat) const;
+        bool canSurrender(int seat) const;
+        bool refuse();
+        int getTotalBet(int seat) const;
         void updateDealerCards();
         bool dealCards();
+        Card* drawCard(bool visible, int seat, int hand);
+        void logEvent(HistoryAction action, int seat, int hand, int amount = 0);
+        void beginRecord();
+        void endRecord();
+        void writeCards(Renderer &out) const;
+        void writeStats(Renderer &out) const;
 
     public:
-        Game(string username, const int gameID);
+        Game(string username, const int gameID, const TableRules &rules = HOUSE_RULES, PlayerPool* pool = nullptr,
+            HandHistory* history = nullptr, Ledger* ledger = nullptr, unsigned long long seed = CLOCK_SEED);
+        Game(SnapshotReader &image, PlayerPool* pool = nullptr, HandHistory* history = nullptr, Ledger* ledger = nullptr);
         ~Game();
         //Getters
         int getGameID() const;
+        const TableRules &getRules() const;
+        unsigned long long getSeed() const;
+        size_t getLastRecord(const char** record) const;
         string displayCards() const;
         string printStats() const;
+        const Renderer &renderCards();
+        const Renderer &renderStats();
+        Decision getBasicDecision(string username) const;
+        int getRunningCount() const;
+        double getTrueCount() const;
+        bool wasRefused() const;
+        void writeImage(SnapshotWriter &image) const;
 
         //Setters
         bool removePlayer(string username);
         bool addPlayer(string username);
+        bool seatPlayer(const Player &player, int seat);
         void startRound();
         int placeBet(string username, int amount);
         bool hit(string username);
+        bool stand(string username);
+        bool split(string username);
         bool surrender(string username);
         bool doubleDown(string username);
         bool bustCheck(string username, bool dealer);
         bool dealerActions();
         bool settleBets();
+        void setCountingSystem(const CountingSystem &system);
+        void setRecording(bool recording);
 
 };
 #endif
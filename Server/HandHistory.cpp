@@ -0,0 +1,403 @@
+//------------------------------HandHistory.cpp---------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the implementation file for the hand history log. Every
+//             round a Game plays is kept as a RoundRecord: a HistoryHeader with
+//             the table, the round number, the cards left in the shoe, the time
+//             the round was dealt, and the table's rules and shoe's seed, then
+//             one fixed size HistoryEvent per player who sat down or left, bet,
+//             card dealt, action and settlement, in the order they happened,
+//             then the name at each seat, padded to a multiple of 8 bytes. The Game writes events into its own record with no lock or
+//             system call, and hands the whole record to the server's
+//             HandHistory once bets are settled. HandHistory copies it into a
+//             ring and a writer thread appends the ring to the log file in
+//             batches, so the game loop never waits on the disk; a record that
+//             finds the ring full is dropped and counted instead.
+//------------------------------------------------------------------------------
+#include "HandHistory.h"
+#include "Deck.h"
+
+static const int NUM_FACES = 13;    //Faces of each suit
+static const char* FACES[NUM_FACES] = {"A", "2", "3", "4", "5", "6", "7", "8", "9", "10", "J", "Q", "K"};
+static const int NUM_SUITS = 4;     //Suits in SUITS
+
+//--------------------------------encodeCard------------------------------------
+//Description: Function that returns the one byte code a Card is logged as: its
+//             suit's index in SUITS times 13 plus its face's index in FACES.
+//Parameters:  - card: Card to encode.
+//------------------------------------------------------------------------------
+uint8_t encodeCard(const Card &card)
+{
+    const string &face = card.getFace();
+    int faceIndex;
+    if (face.size() == 2)
+    {
+        faceIndex = 9; //10
+    }
+    else if (face[0] >= '2' && face[0] <= '9')
+    {
+        faceIndex = face[0] - '1';
+    }
+    else
+    {
+        faceIndex = face[0] == 'A' ? 0 : face[0] == 'J' ? 10 : face[0] == 'Q' ? 11 : 12;
+    }
+    const string &suit = card.getSuit();
+    for (int i = 0; i < NUM_SUITS; i++)
+    {
+        if (suit == SUITS[i])
+        {
+            return i * NUM_FACES + faceIndex;
+        }
+    }
+    return HISTORY_NO_CARD;
+} // end of encodeCard
+
+//--------------------------------decodeCard------------------------------------
+//Description: Function that returns a logged card code as its Card prints, or
+//             an empty string for HISTORY_NO_CARD.
+//Parameters:  - code: Card code from encodeCard.
+//------------------------------------------------------------------------------
+string decodeCard(uint8_t code)
+{
+    if (code >= NUM_SUITS * NUM_FACES)
+    {
+        return "";
+    }
+    return string("[ ") + FACES[code % NUM_FACES] + SUITS[code / NUM_FACES] + " ]";
+} // end of decodeCard
+
+//-------------------------------restoreCard------------------------------------
+//Description: Function that returns the face down Card a code from encodeCard
+//             stands for, as a Deck makes it.
+//Parameters:  - code: Card code below CARDS_PER_DECK.
+//------------------------------------------------------------------------------
+Card restoreCard(uint8_t code)
+{
+    const char* face = FACES[code % NUM_FACES];
+    return Card(SUITS[code / NUM_FACES], face, cardValues.at(face));
+} // end of restoreCard
+
+//-------------------------------RoundRecord------------------------------------
+//Description: Constructor for RoundRecord. Nothing is recorded until a round
+//             begins.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+RoundRecord::RoundRecord()
+{
+    this->header = reinterpret_cast<HistoryHeader*>(this->bytes);
+    this->events = reinterpret_cast<HistoryEvent*>(this->bytes + sizeof(HistoryHeader));
+    this->header->size = 0;
+    this->recording = false;
+    memset(this->nameSizes, 0, sizeof(this->nameSizes));
+} // end of RoundRecord
+
+//-------------------------------isRecording------------------------------------
+//Description: Public function that returns whether or not a round has begun
+//             and not yet been finished.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+bool RoundRecord::isRecording() const
+{
+    return this->recording;
+} // end of isRecording
+
+//-------------------------------getNumEvents-----------------------------------
+//Description: Public function that returns the events recorded this round.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+int RoundRecord::getNumEvents() const
+{
+    return this->header->numEvents;
+} // end of getNumEvents
+
+//-------------------------------getFinished------------------------------------
+//Description: Public function that returns the size of the last round finished
+//             and points to its record, or 0 if none has been finished since a
+//             round began.
+//Parameters:  - record: Set to the start of the record.
+//------------------------------------------------------------------------------
+size_t RoundRecord::getFinished(const char** record) const
+{
+    *record = this->bytes;
+    return this->recording ? 0 : this->header->size;
+} // end of getFinished
+
+//-----------------------------------begin--------------------------------------
+//Description: Public function that starts the record of a new round, with no
+//             events and nobody seated.
+//Parameters:  - table:     Game ID of the table.
+//             - round:     Game's round number.
+//             - shoeCards: Cards left in the shoe before the round is dealt.
+//             - rules:     Rules the table is played by.
+//             - seed:      Seed the table's shoe is shuffled from.
+//------------------------------------------------------------------------------
+void RoundRecord::begin(int table, int round, int shoeCards, const TableRules &rules, unsigned long long seed)
+{
+    timeval now;
+    gettimeofday(&now, nullptr);
+    this->header->magic = HISTORY_MAGIC;
+    this->header->size = 0;
+    this->header->table = table;
+    this->header->round = round;
+    this->header->shoeCards = shoeCards;
+    this->header->numEvents = 0;
+    this->header->decks = rules.decks;
+    this->header->flags = 0;
+    this->header->time = now.tv_sec * 1000000LL + now.tv_usec;
+    this->header->seed = seed;
+    this->header->rules = (rules.hitSoft17 ? HISTORY_HIT_SOFT_17 : 0) | (rules.doubleAfterSplit ? HISTORY_DOUBLE_AFTER_SPLIT : 0)
+        | (rules.lateSurrender ? HISTORY_LATE_SURRENDER : 0);
+    this->header->naturalPays = rules.naturalPays;
+    this->header->naturalPer = rules.naturalPer;
+    memset(this->header->padding, 0, sizeof(this->header->padding));
+    memset(this->nameSizes, 0, sizeof(this->nameSizes));
+    this->recording = true;
+} // end of begin
+
+//----------------------------------setName-------------------------------------
+//Description: Public function that records the name of the player at a seat,
+//             cut off at HISTORY_NAME_SIZE bytes.
+//Parameters:  - seat: Seat the player sits at.
+//             - name: Player's username.
+//------------------------------------------------------------------------------
+void RoundRecord::setName(int seat, const string &name)
+{
+    if (seat < 0 || seat >= HISTORY_SEATS)
+    {
+        return;
+    }
+    this->nameSizes[seat] = min<size_t>(name.size(), HISTORY_NAME_SIZE);
+    memcpy(this->names[seat], name.data(), this->nameSizes[seat]);
+} // end of setName
+
+//---------------------------------addEvent-------------------------------------
+//Description: Public function that records one thing that happened in the
+//             round. Past HISTORY_MAX_EVENTS the event is left out and the record
+//             is marked truncated.
+//Parameters:  - action: What happened.
+//             - seat:   Seat it happened at, or HISTORY_DEALER.
+//             - hand:   Hand at the seat.
+//             - card:   Card code from encodeCard, or HISTORY_NO_CARD.
+//             - amount: Depends on the action, see HistoryAction.
+//------------------------------------------------------------------------------
+void RoundRecord::addEvent(HistoryAction action, int seat, int hand, uint8_t card, int amount)
+{
+    if (!this->recording)
+    {
+        return;
+    }
+    if (this->header->numEvents >= HISTORY_MAX_EVENTS)
+    {
+        this->header->flags |= HISTORY_TRUNCATED;
+        return;
+    }
+    HistoryEvent &event = this->events[this->header->numEvents++];
+    event.action = action;
+    event.seat = seat;
+    event.hand = hand;
+    event.card = card;
+    event.amount = amount;
+} // end of addEvent
+
+//----------------------------------finish--------------------------------------
+//Description: Public function that ends the round, writing the names after the
+//             events and padding the record. Returns the size of the record and
+//             points to it, valid until the next round begins.
+//Parameters:  - record: Set to the start of the record.
+//------------------------------------------------------------------------------
+size_t RoundRecord::finish(const char** record)
+{
+    size_t size = sizeof(HistoryHeader) + this->header->numEvents * sizeof(HistoryEvent);
+    for (int i = 0; i < HISTORY_SEATS; i++)
+    {
+        this->bytes[size++] = this->nameSizes[i];
+        memcpy(this->bytes + size, this->names[i], this->nameSizes[i]);
+        size += this->nameSizes[i];
+    }
+    while (size % HISTORY_ALIGN != 0)
+    {
+        this->bytes[size++] = '\0';
+    }
+    this->header->size = size;
+    this->recording = false;
+    *record = this->bytes;
+    return size;
+} // end of finish
+
+//-------------------------------HandHistory------------------------------------
+//Description: Constructor for HandHistory. Opens the log for appending and
+//             starts the writer thread; if the log can't be opened nothing is
+//             logged.
+//Parameters:  - path: Path of the log file, created if it doesn't exist.
+//------------------------------------------------------------------------------
+HandHistory::HandHistory(const string &path)
+{
+    this->head = 0;
+    this->tail = 0;
+    this->dropped = 0;
+    this->stopped = false;
+    pthread_mutex_init(&this->mtx, nullptr);
+    pthread_cond_init(&this->wake, nullptr);
+    this->fd = open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+    if (this->fd < 0)
+    {
+        perror("open() failure");
+    }
+    else if (pthread_create(&this->thread, nullptr, writer, this) != 0)
+    {
+        perror("pthread_create() failure");
+        close(this->fd);
+        this->fd = -1;
+    }
+} // end of HandHistory
+
+//-------------------------------~HandHistory-----------------------------------
+//Description: Destructor for HandHistory. Writes every record still in the
+//             ring before closing the log.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+HandHistory::~HandHistory()
+{
+    if (this->fd >= 0)
+    {
+        pthread_mutex_lock(&this->mtx);
+        this->stopped = true;
+        pthread_cond_signal(&this->wake);
+        pthread_mutex_unlock(&this->mtx);
+        pthread_join(this->thread, nullptr);
+        close(this->fd);
+    }
+    pthread_cond_destroy(&this->wake);
+    pthread_mutex_destroy(&this->mtx);
+} // end of ~HandHistory
+
+//---------------------------------isOpen---------------------------------------
+//Description: Public function that returns whether or not the log is open.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+bool HandHistory::isOpen() const
+{
+    return this->fd >= 0;
+} // end of isOpen
+
+//--------------------------------getDropped------------------------------------
+//Description: Public function that returns the records dropped because the
+//             ring was full.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+unsigned long long HandHistory::getDropped() const
+{
+    pthread_mutex_lock(&this->mtx);
+    unsigned long long count = this->dropped;
+    pthread_mutex_unlock(&this->mtx);
+    return count;
+} // end of getDropped
+
+//----------------------------------append--------------------------------------
+//Description: Public function that copies a round's record into the ring for
+//             the writer thread. Never waits on the disk; returns false and
+//             counts the record as dropped if the ring has no room for it.
+//Parameters:  - record: Start of the record.
+//             - size:   Bytes in the record.
+//------------------------------------------------------------------------------
+bool HandHistory::append(const char* record, size_t size)
+{
+    if (this->fd < 0)
+    {
+        return false;
+    }
+    pthread_mutex_lock(&this->mtx);
+    if (HISTORY_RING_SIZE - (this->head - this->tail) < size)
+    {
+        this->dropped++;
+        pthread_mutex_unlock(&this->mtx);
+        return false;
+    }
+    size_t offset = this->head % HISTORY_RING_SIZE;
+    size_t first = min(size, HISTORY_RING_SIZE - offset);
+    memcpy(this->ring + offset, record, first);
+    memcpy(this->ring, record + first, size - first);
+    this->head += size;
+    if (this->head - this->tail >= HISTORY_RING_SIZE / 2)
+    { //Filling up, don't wait for the next batch
+        pthread_cond_signal(&this->wake);
+    }
+    pthread_mutex_unlock(&this->mtx);
+    return true;
+} // end of append
+
+//----------------------------------writer--------------------------------------
+//Description: Private function run by the writer thread. Every HISTORY_FLUSH_MS,
+//             or sooner once the ring is half full, it writes out what the
+//             ring holds, until the HandHistory is destroyed.
+//Parameters:  - arg: The HandHistory.
+//------------------------------------------------------------------------------
+void* HandHistory::writer(void* arg)
+{
+    HandHistory* history = (HandHistory*) arg;
+    pthread_mutex_lock(&history->mtx);
+    while (true)
+    {
+        if (!history->stopped && history->head - history->tail < HISTORY_RING_SIZE / 2)
+        {
+            timeval now;
+            gettimeofday(&now, nullptr);
+            long nsec = now.tv_usec * 1000L + HISTORY_FLUSH_MS * 1000000L;
+            timespec until{ now.tv_sec + nsec / 1000000000L, nsec % 1000000000L };
+            pthread_cond_timedwait(&history->wake, &history->mtx, &until);
+        }
+        bool stopped = history->stopped;
+        pthread_mutex_unlock(&history->mtx);
+        bool written = history->writeBatch();
+        pthread_mutex_lock(&history->mtx);
+        if (stopped && (!written || history->head == history->tail))
+        {
+            break;
+        }
+    }
+    pthread_mutex_unlock(&history->mtx);
+    return nullptr;
+} // end of writer
+
+//--------------------------------writeBatch------------------------------------
+//Description: Private function that writes everything in the ring to the log
+//             with the lock released, so tables keep appending meanwhile.
+//             Returns false if the write failed, in which case the batch is
+//             given up rather than retried forever.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+bool HandHistory::writeBatch()
+{
+    pthread_mutex_lock(&this->mtx);
+    unsigned long long start = this->tail;
+    unsigned long long end = this->head;
+    pthread_mutex_unlock(&this->mtx);
+
+    bool written = true;
+    unsigned long long next = start;
+    while (next < end && written)
+    {
+        size_t offset = next % HISTORY_RING_SIZE;
+        size_t size = min<unsigned long long>(end - next, HISTORY_RING_SIZE - offset);
+        ssize_t bytes = write(this->fd, this->ring + offset, size);
+        if (bytes < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (bytes <= 0)
+        {
+            perror("write() failure");
+            written = false;
+        }
+        else
+        {
+            next += bytes;
+        }
+    }
+
+    pthread_mutex_lock(&this->mtx);
+    this->tail = end;
+    pthread_mutex_unlock(&this->mtx);
+    return written;
+} // end of writeBatch
@@ -0,0 +1,159 @@
+//-------------------------------HandHistory.h----------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the header file for the hand history log. Every round a
+//             Game plays is kept as a RoundRecord: a HistoryHeader with the
+//             table, the round number, the cards left in the shoe, the time the
+//             round was dealt, and the table's rules and the seed its shoe is
+//             shuffled from, then one fixed size HistoryEvent per player who sat
+//             down or left, bet, card dealt, action and settlement, in the order
+//             they happened, then the name at each seat, padded to a multiple of
+//             8 bytes. A table's records from its first round on are enough to
+//             play it again exactly, see the History package's Replay. The
+//             Game writes events into its own record with no lock or system
+//             call, and hands the whole record to the server's HandHistory once
+//             bets are settled. HandHistory copies it into a ring and a writer
+//             thread appends the ring to the log file in batches, so the game
+//             loop never waits on the disk; a record that finds the ring full
+//             is dropped and counted instead. The log is the records back to
+//             back in the machine's byte order.
+//------------------------------------------------------------------------------
+#ifndef HANDHISTORY_H
+#define HANDHISTORY_H
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cstdio>
+#include <cerrno>
+#include <algorithm>
+#include <string>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/time.h>
+#include "card.h"
+#include "Rules.h"
+using namespace std;
+
+static const uint32_t HISTORY_MAGIC = 0x324A4242;  //"BBJ2", starts every record
+static const int HISTORY_SEATS = 4;                 //Seats named in every record, as at a Game's table
+static const int HISTORY_NAME_SIZE = 50;            //Longest name kept, as long as a username
+static const int HISTORY_ALIGN = 8;                 //Every record's size is a multiple of this
+static const int HISTORY_MAX_EVENTS = 512;          //Most events in a round, more marks the record truncated
+static const uint8_t HISTORY_DEALER = 0xFF;         //Seat of the dealer in an event
+static const uint8_t HISTORY_NO_CARD = 0xFF;        //Card of an event that deals none
+static const uint8_t HISTORY_TRUNCATED = 1;         //Header flag for a round with events left out
+static const uint8_t HISTORY_HIT_SOFT_17 = 1;       //Header rules bit for TableRules::hitSoft17
+static const uint8_t HISTORY_DOUBLE_AFTER_SPLIT = 2;    //Header rules bit for TableRules::doubleAfterSplit
+static const uint8_t HISTORY_LATE_SURRENDER = 4;    //Header rules bit for TableRules::lateSurrender
+static const size_t HISTORY_RING_SIZE = 1 << 20;    //Bytes of records waiting for the writer thread
+static const int HISTORY_FLUSH_MS = 100;            //Longest a record waits before it is written
+
+//What a HistoryEvent records
+enum class HistoryAction : uint8_t
+{
+    BET,            //amount is the bet placed on the hand
+    DEAL,           //card is dealt to the hand, amount is 1 face up and 0 face down
+    HIT,
+    STAND,
+    SPLIT,          //hand is the new hand the second card of the pair moved to, amount the hand split
+    DOUBLE_DOWN,    //amount is the bet added
+    SURRENDER,
+    SETTLE,         //amount is the balance won, or lost if negative, on the hand
+    SIT,            //The player sat down since the last round, amount is their balance
+    LEAVE           //The player left in the middle of the round
+};
+
+//Name of each HistoryAction, in order
+static const char* const HISTORY_ACTIONS[] = { "bet", "deal", "hit", "stand", "split", "double", "surrender", "settle", "sit", "leave" };
+
+//Start of every round's record, followed by the events and the names
+struct HistoryHeader
+{
+    uint32_t magic;         //HISTORY_MAGIC
+    uint32_t size;          //Bytes in the record, header included
+    uint32_t table;         //Game ID of the table
+    uint32_t round;         //Game's round number
+    uint32_t shoeCards;     //Cards left in the shoe before the round was dealt
+    uint16_t numEvents;     //Events after the header
+    uint8_t decks;          //Decks the shoe is made of
+    uint8_t flags;          //HISTORY_TRUNCATED
+    int64_t time;           //Microseconds since the epoch when the round was dealt
+    uint64_t seed;          //Seed the table's shoe is shuffled from
+    uint8_t rules;          //HISTORY_HIT_SOFT_17, HISTORY_DOUBLE_AFTER_SPLIT and HISTORY_LATE_SURRENDER
+    uint8_t naturalPays;    //A winning natural pays naturalPays to naturalPer
+    uint8_t naturalPer;
+    uint8_t padding[5];
+};
+
+//One thing that happened in a round
+struct HistoryEvent
+{
+    HistoryAction action;
+    uint8_t seat;           //Seat the event happened at, or HISTORY_DEALER
+    uint8_t hand;           //Hand at the seat, split hands counting from 0
+    uint8_t card;           //Card code from encodeCard, or HISTORY_NO_CARD
+    int32_t amount;         //Depends on the action
+};
+
+uint8_t encodeCard(const Card &card);
+string decodeCard(uint8_t code);
+Card restoreCard(uint8_t code);
+
+class RoundRecord
+{
+    private:
+        alignas(HISTORY_ALIGN) char bytes[sizeof(HistoryHeader) + HISTORY_MAX_EVENTS * sizeof(HistoryEvent)
+            + HISTORY_SEATS * (HISTORY_NAME_SIZE + 1) + HISTORY_ALIGN];  //The record as it is logged
+        HistoryHeader* header;                          //Header at the start of the bytes
+        HistoryEvent* events;                           //Events right after the header
+        char names[HISTORY_SEATS][HISTORY_NAME_SIZE];   //Name at each seat, written after the events
+        uint8_t nameSizes[HISTORY_SEATS];               //Bytes in each name, 0 if nobody is seated
+        bool recording;                                 //Whether or not a round has begun and not been finished
+
+    public:
+        //Constructors
+        RoundRecord();
+        RoundRecord(const RoundRecord &record) = delete;
+        RoundRecord &operator=(const RoundRecord &record) = delete;
+        //Getters
+        bool isRecording() const;
+        int getNumEvents() const;
+        size_t getFinished(const char** record) const;
+
+        //Setters
+        void begin(int table, int round, int shoeCards, const TableRules &rules, unsigned long long seed);
+        void setName(int seat, const string &name);
+        void addEvent(HistoryAction action, int seat, int hand, uint8_t card, int amount);
+        size_t finish(const char** record);
+};
+
+class HandHistory
+{
+    private:
+        int fd;                         //Log file, opened for appending
+        char ring[HISTORY_RING_SIZE];   //Records waiting to be written
+        unsigned long long head;        //Bytes ever copied into the ring
+        unsigned long long tail;        //Bytes ever written to the log
+        unsigned long long dropped;     //Records that found the ring full
+        bool stopped;                   //Whether or not the writer thread should finish up
+        mutable pthread_mutex_t mtx;    //Guards the ring for every table's thread
+        pthread_cond_t wake;            //Wakes the writer thread early when the ring is filling up
+        pthread_t thread;               //Writer thread
+        static void* writer(void* arg);
+        bool writeBatch();
+
+    public:
+        //Constructors
+        HandHistory(const string &path);
+        HandHistory(const HandHistory &history) = delete;
+        HandHistory &operator=(const HandHistory &history) = delete;
+        ~HandHistory();
+        //Getters
+        bool isOpen() const;
+        unsigned long long getDropped() const;
+
+        //Setters
+        bool append(const char* record, size_t size);
+};
+#endif
@@ -0,0 +1,372 @@
+//---------------------------------Ledger.cpp-----------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the implementation file for the Ledger class. Each
+//             settled round posts the state of every seated Player to a
+//             write-ahead log, and a committer thread writes and syncs whatever
+//             has been posted in one batch while the tables wait on it, so the
+//             entries of every table that settled during one sync share the
+//             next. On startup the log is read back up to its last whole entry
+//             and rewritten with only the latest entry of every player.
+//------------------------------------------------------------------------------
+#include "Ledger.h"
+
+static const uint32_t FNV_OFFSET = 2166136261u; //FNV-1a starting hash
+static const uint32_t FNV_PRIME = 16777619u;    //FNV-1a multiplier
+
+//----------------------------------Ledger--------------------------------------
+//Description: Constructor for Ledger. Reads back the log, rewrites it with the
+//             latest entry of every player, opens it for appending and starts
+//             the committer thread; if any of that fails nothing is kept.
+//Parameters:  - path: Path of the log.
+//------------------------------------------------------------------------------
+Ledger::Ledger(const string &path)
+{
+    this->path = path;
+    this->fd = -1;
+    this->posted = 0;
+    this->synced = 0;
+    this->syncs = 0;
+    this->stopped = false;
+    this->failed = false;
+    this->pending.reserve(LEDGER_BATCH);
+    this->batch.reserve(LEDGER_BATCH);
+    pthread_mutex_init(&this->mtx, nullptr);
+    pthread_cond_init(&this->wake, nullptr);
+    pthread_cond_init(&this->committed, nullptr);
+    if (!recover() || !checkpoint())
+    {
+        return;
+    }
+    this->synced = this->posted;
+    this->fd = open(path.c_str(), O_WRONLY | O_APPEND);
+    if (this->fd < 0)
+    {
+        perror("open() failure");
+    }
+    else if (pthread_create(&this->thread, nullptr, committer, this) != 0)
+    {
+        perror("pthread_create() failure");
+        close(this->fd);
+        this->fd = -1;
+    }
+} // end of Ledger
+
+//---------------------------------~Ledger--------------------------------------
+//Description: Destructor for Ledger. Commits every entry still posted before
+//             closing the log.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+Ledger::~Ledger()
+{
+    if (this->fd >= 0)
+    {
+        pthread_mutex_lock(&this->mtx);
+        this->stopped = true;
+        pthread_cond_signal(&this->wake);
+        pthread_mutex_unlock(&this->mtx);
+        pthread_join(this->thread, nullptr);
+        close(this->fd);
+    }
+    pthread_cond_destroy(&this->committed);
+    pthread_cond_destroy(&this->wake);
+    pthread_mutex_destroy(&this->mtx);
+} // end of ~Ledger
+
+//---------------------------------isOpen---------------------------------------
+//Description: Public function that returns whether or not the log is open.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+bool Ledger::isOpen() const
+{
+    return this->fd >= 0;
+} // end of isOpen
+
+//-----------------------------------find---------------------------------------
+//Description: Public function that returns whether or not the ledger has an
+//             entry for a player, and if so sets their record from it.
+//Parameters:  - username: Player's username.
+//             - player:   Set to the player's record.
+//------------------------------------------------------------------------------
+bool Ledger::find(const string &username, Player* player) const
+{
+    pthread_mutex_lock(&this->mtx);
+    auto found = this->latest.find(username.substr(0, LEDGER_NAME_SIZE));
+    bool known = found != this->latest.end();
+    if (known)
+    {
+        const LedgerEntry &entry = found->second;
+        *player = Player(username, entry.balance, entry.wins, entry.losses);
+    }
+    pthread_mutex_unlock(&this->mtx);
+    return known;
+} // end of find
+
+//-------------------------------getNumPlayers----------------------------------
+//Description: Public function that returns the number of players the ledger
+//             has an entry for.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+int Ledger::getNumPlayers() const
+{
+    pthread_mutex_lock(&this->mtx);
+    int count = this->latest.size();
+    pthread_mutex_unlock(&this->mtx);
+    return count;
+} // end of getNumPlayers
+
+//---------------------------------getSyncs-------------------------------------
+//Description: Public function that returns the batches synced to the disk.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+unsigned long long Ledger::getSyncs() const
+{
+    pthread_mutex_lock(&this->mtx);
+    unsigned long long count = this->syncs;
+    pthread_mutex_unlock(&this->mtx);
+    return count;
+} // end of getSyncs
+
+//-----------------------------------post---------------------------------------
+//Description: Public function that posts a Player's state for the committer
+//             thread. Never waits on the disk; returns the entry's sequence to
+//             sync on, or 0 if the ledger isn't open.
+//Parameters:  - player: Player's record after the round was settled.
+//------------------------------------------------------------------------------
+unsigned long long Ledger::post(const Player &player)
+{
+    if (this->fd < 0)
+    {
+        return 0;
+    }
+    LedgerEntry entry;
+    memset(&entry, 0, sizeof(entry));
+    const string &name = player.getName();
+    entry.magic = LEDGER_MAGIC;
+    entry.balance = player.getBalance();
+    entry.wins = player.getWins();
+    entry.losses = player.getLosses();
+    entry.nameLength = min<size_t>(name.size(), LEDGER_NAME_SIZE);
+    memcpy(entry.name, name.data(), entry.nameLength);
+
+    pthread_mutex_lock(&this->mtx);
+    entry.sequence = ++this->posted;
+    entry.checksum = checksum(entry);
+    this->pending.push_back(entry);
+    this->latest[string(entry.name, entry.nameLength)] = entry;
+    pthread_cond_signal(&this->wake);
+    pthread_mutex_unlock(&this->mtx);
+    return entry.sequence;
+} // end of post
+
+//-----------------------------------sync---------------------------------------
+//Description: Public function that waits until every entry up to a sequence is
+//             synced to the disk. Returns false if the ledger failed to write
+//             them.
+//Parameters:  - sequence: Sequence returned by post.
+//------------------------------------------------------------------------------
+bool Ledger::sync(unsigned long long sequence)
+{
+    pthread_mutex_lock(&this->mtx);
+    while (this->synced < sequence && !this->failed)
+    {
+        pthread_cond_wait(&this->committed, &this->mtx);
+    }
+    bool durable = this->synced >= sequence;
+    pthread_mutex_unlock(&this->mtx);
+    return durable;
+} // end of sync
+
+//--------------------------------committer-------------------------------------
+//Description: Private function run by the committer thread. Whenever entries
+//             have been posted it takes them all as one batch, writes and syncs
+//             it, and wakes the tables waiting on it, until the Ledger is
+//             destroyed.
+//Parameters:  - arg: The Ledger.
+//------------------------------------------------------------------------------
+void* Ledger::committer(void* arg)
+{
+    Ledger* ledger = (Ledger*) arg;
+    pthread_mutex_lock(&ledger->mtx);
+    while (true)
+    {
+        while (!ledger->stopped && ledger->pending.empty())
+        {
+            pthread_cond_wait(&ledger->wake, &ledger->mtx);
+        }
+        if (ledger->pending.empty())
+        {
+            break;
+        }
+        ledger->batch.swap(ledger->pending);
+        unsigned long long last = ledger->posted;
+        pthread_mutex_unlock(&ledger->mtx);
+        bool written = ledger->writeBatch();
+        pthread_mutex_lock(&ledger->mtx);
+        if (written)
+        {
+            ledger->synced = last;
+        }
+        ledger->failed = ledger->failed || !written;
+        ledger->syncs++;
+        pthread_cond_broadcast(&ledger->committed);
+    }
+    pthread_mutex_unlock(&ledger->mtx);
+    return nullptr;
+} // end of committer
+
+//--------------------------------writeBatch------------------------------------
+//Description: Private function that writes the batch to the log and syncs it,
+//             with the lock released so tables keep posting meanwhile. Returns
+//             false if the write or sync failed.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+bool Ledger::writeBatch()
+{
+    const char* bytes = (const char*) this->batch.data();
+    size_t size = this->batch.size() * sizeof(LedgerEntry);
+    bool written = true;
+    while (size > 0 && written)
+    {
+        ssize_t count = write(this->fd, bytes, size);
+        if (count < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (count <= 0)
+        {
+            perror("write() failure");
+            written = false;
+        }
+        else
+        {
+            bytes += count;
+            size -= count;
+        }
+    }
+    if (written && fdatasync(this->fd) != 0)
+    {
+        perror("fdatasync() failure");
+        written = false;
+    }
+    this->batch.clear();
+    return written;
+} // end of writeBatch
+
+//----------------------------------recover-------------------------------------
+//Description: Private function that reads the log back, keeping the latest
+//             entry of every player. Reading stops at the first entry that is
+//             cut off or fails its checksum, as the last write before a crash
+//             may not have reached the disk whole. Returns false if the log
+//             exists but can't be read.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+bool Ledger::recover()
+{
+    int in = open(this->path.c_str(), O_RDONLY);
+    if (in < 0)
+    {
+        if (errno == ENOENT)
+        {
+            return true;
+        }
+        perror("open() failure");
+        return false;
+    }
+    vector<LedgerEntry> entries(LEDGER_BATCH);
+    size_t held = 0;
+    bool whole = true;
+    while (whole)
+    {
+        ssize_t count = read(in, (char*) entries.data() + held, entries.size() * sizeof(LedgerEntry) - held);
+        if (count < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (count < 0)
+        {
+            perror("read() failure");
+            close(in);
+            return false;
+        }
+        held += count;
+        size_t numEntries = held / sizeof(LedgerEntry);
+        for (size_t i = 0; i < numEntries && whole; i++)
+        {
+            const LedgerEntry &entry = entries[i];
+            whole = entry.magic == LEDGER_MAGIC && entry.checksum == checksum(entry) && entry.nameLength <= LEDGER_NAME_SIZE;
+            if (whole)
+            {
+                this->latest[string(entry.name, entry.nameLength)] = entry;
+                this->posted = max<unsigned long long>(this->posted, entry.sequence);
+            }
+        }
+        whole = whole && count > 0;
+        memmove(entries.data(), (const char*) entries.data() + numEntries * sizeof(LedgerEntry), held % sizeof(LedgerEntry));
+        held %= sizeof(LedgerEntry);
+    }
+    close(in);
+    return true;
+} // end of recover
+
+//--------------------------------checkpoint------------------------------------
+//Description: Private function that writes the latest entry of every player to
+//             a new log, syncs it and renames it over the old one, so the log
+//             holds one entry per player after every start. Returns false if
+//             the new log can't be written.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+bool Ledger::checkpoint()
+{
+    string temporary = this->path + ".tmp";
+    int out = open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (out < 0)
+    {
+        perror("open() failure");
+        return false;
+    }
+    for (const auto &player : this->latest)
+    {
+        this->batch.push_back(player.second);
+    }
+    swap(out, this->fd);
+    bool written = writeBatch();
+    swap(out, this->fd);
+    close(out);
+    if (written && rename(temporary.c_str(), this->path.c_str()) != 0)
+    {
+        perror("rename() failure");
+        written = false;
+    }
+    if (!written)
+    {
+        remove(temporary.c_str());
+        return false;
+    }
+    size_t slash = this->path.rfind('/');
+    int directory = open(slash == string::npos ? "." : this->path.substr(0, slash + 1).c_str(), O_RDONLY);
+    if (directory >= 0)
+    { //Make the rename itself durable
+        fsync(directory);
+        close(directory);
+    }
+    return true;
+} // end of checkpoint
+
+//---------------------------------checksum-------------------------------------
+//Description: Private function that returns the FNV-1a hash of an entry with
+//             its checksum taken as 0.
+//Parameters:  - entry: Entry to hash.
+//------------------------------------------------------------------------------
+uint32_t Ledger::checksum(const LedgerEntry &entry)
+{
+    LedgerEntry copy = entry;
+    copy.checksum = 0;
+    const unsigned char* bytes = (const unsigned char*) &copy;
+    uint32_t hash = FNV_OFFSET;
+    for (size_t i = 0; i < sizeof(copy); i++)
+    {
+        hash = (hash ^ bytes[i]) * FNV_PRIME;
+    }
+    return hash;
+} // end of checksum
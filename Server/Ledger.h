@@ -0,0 +1,93 @@
+//----------------------------------Ledger.h------------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the header file for the Ledger class. The ledger keeps
+//             every player's balance, wins and losses on disk, keyed by
+//             username, so they outlive a player leaving the server or the
+//             server going down. Each settled round posts the state of every
+//             seated Player as a fixed size LedgerEntry to a write-ahead log;
+//             a committer thread writes what has been posted and syncs it to
+//             the disk, and the table waits until its entries are synced before
+//             it moves on. Entries posted by every table while one sync is
+//             under way go out together in the next, so a busy server pays one
+//             sync per batch instead of one per bet. On startup the log is read
+//             back, a torn entry at its end left behind by a crash is cut off,
+//             and the latest entry of every player is written to a new log that
+//             replaces the old one. The server's PlayerPool falls back on the
+//             ledger for players it holds no record of.
+//------------------------------------------------------------------------------
+#ifndef LEDGER_H
+#define LEDGER_H
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cstdio>
+#include <cerrno>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "Player.h"
+using namespace std;
+
+static const uint32_t LEDGER_MAGIC = 0x4C4A4242;    //"BBJL", starts every entry
+static const int LEDGER_NAME_SIZE = 50;             //Longest name kept, as long as a username
+static const size_t LEDGER_BATCH = 1024;            //Entries room is kept for in each batch
+
+//A Player's state after a settled round
+struct LedgerEntry
+{
+    uint32_t magic;                 //LEDGER_MAGIC
+    uint32_t checksum;              //FNV-1a of the entry with this field 0
+    uint64_t sequence;              //Order the entry was posted in
+    int32_t balance;
+    int32_t wins;
+    int32_t losses;
+    uint8_t nameLength;             //Bytes in the name
+    char name[LEDGER_NAME_SIZE];    //Username, null padded
+    uint8_t padding;
+};
+
+class Ledger
+{
+    private:
+        string path;                                    //Path of the log
+        int fd;                                         //Log file, opened for appending
+        vector<LedgerEntry> pending;                    //Entries posted since the committer took the last batch
+        vector<LedgerEntry> batch;                      //Entries the committer is writing
+        unordered_map<string, LedgerEntry> latest;      //Latest entry of every player
+        unsigned long long posted;                      //Sequence of the last entry posted
+        unsigned long long synced;                      //Sequence of the last entry synced to the disk
+        unsigned long long syncs;                       //Batches synced
+        bool stopped;                                   //Whether or not the committer should finish up
+        bool failed;                                    //Whether or not a write or sync has failed
+        mutable pthread_mutex_t mtx;                    //Guards the ledger for every table's thread
+        pthread_cond_t wake;                            //Wakes the committer when entries are posted
+        pthread_cond_t committed;                       //Wakes the tables waiting on a sync
+        pthread_t thread;                               //Committer thread
+        static void* committer(void* arg);
+        bool writeBatch();
+        bool recover();
+        bool checkpoint();
+        static uint32_t checksum(const LedgerEntry &entry);
+
+    public:
+        //Constructors
+        Ledger(const string &path);
+        Ledger(const Ledger &ledger) = delete;
+        Ledger &operator=(const Ledger &ledger) = delete;
+        ~Ledger();
+        //Getters
+        bool isOpen() const;
+        bool find(const string &username, Player* player) const;
+        int getNumPlayers() const;
+        unsigned long long getSyncs() const;
+
+        //Setters
+        unsigned long long post(const Player &player);
+        bool sync(unsigned long long sequence);
+};
+#endif
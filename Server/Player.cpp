@@ -2,27 +2,54 @@
 //Author: Johnathan Hewit
 //Team: LuckyNo13
 //Description: This is the implementation file for the Player Class. It contains the
-//             username, balance in dollars, total points of the cards in the 
-//             player's hand, the number of wins and losses, and a vector that
-//             contains the player's cards for the given round as private members.
+//             username, balance in dollars, and the number of wins and losses
+//             as private members. The cards a player holds each round belong
+//             to their Seat.
 //             It exposes functions to retrieve and adjust those attributes. The 
 //             class is used within Seats and is created by the Game object.
 //------------------------------------------------------------------------------
 #include "Player.h"
 
 //----------------------------------Player--------------------------------------
-//Description: Default constructor for Player.
+//Description: Default constructor for Player, for an empty Seat or a free slot
+//             in the PlayerPool.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+Player::Player()
+{
+  this->balance = DEFAULT_BALANCE;
+  this->wins = 0;
+  this->losses = 0;
+} // end of Player
+
+//----------------------------------Player--------------------------------------
+//Description: Constructor for a new Player with the default balance.
 //Parameters:  - username: The Player's username.
 //------------------------------------------------------------------------------
 Player::Player(const string username)
 {
   this->username = username;
   this->balance = DEFAULT_BALANCE;
-  this->points = 0;
   this->wins = 0;
   this->losses = 0;
 } // end of Player
 
+//----------------------------------Player--------------------------------------
+//Description: Constructor for a returning Player whose record was kept, as in
+//             the Ledger.
+//Parameters:  - username: The Player's username.
+//             - balance:  The Player's balance.
+//             - wins:     The Player's total wins.
+//             - losses:   The Player's total losses.
+//------------------------------------------------------------------------------
+Player::Player(const string username, int balance, int wins, int losses)
+{
+  this->username = username;
+  this->balance = balance;
+  this->wins = wins;
+  this->losses = losses;
+} // end of Player
+
 //----------------------------------Player--------------------------------------
 //Description: Copy constructor for Player.
 //Parameters:  - player: The Player that we're copying.
@@ -31,6 +58,8 @@ Player::Player(const Player &player)
 {
   this->username = player.getName();
   this->balance = player.getBalance();
+  this->wins = player.getWins();
+  this->losses = player.getLosses();
 } // end of Player
 
 //---------------------------------~Player--------------------------------------
@@ -39,14 +68,13 @@ Player::Player(const Player &player)
 //------------------------------------------------------------------------------
 Player::~Player()
 {
-  discardHand();
 } // end of ~Player
 
 //----------------------------------getName-------------------------------------
 //Description: Returns the Player's username.
 //Parameters:  N/A
 //------------------------------------------------------------------------------
-string Player::getName() const
+const string &Player::getName() const
 {
   return this->username;
 } // end of getName
@@ -60,26 +88,6 @@ int Player::getBalance() const
   return this->balance;
 } // end of getBalance
 
-//---------------------------------getPoints------------------------------------
-//Description: Returns the Player's total number of points based on the sum of 
-//             card values in the Player's current hand.
-//Parameters:  N/A
-//------------------------------------------------------------------------------
-int Player::getPoints() const
-{
-  return this->points;
-} // end of getPoints
-
-//---------------------------------getHand--------------------------------------
-//Description: Returns the Player's hand (vector of Card pointers) back to the
-//             calling function.
-//Parameters:  N/A
-//------------------------------------------------------------------------------
-vector<Card*> Player::getHand() const
-{
-  return this->hand;
-} // end of getCards
-
 //---------------------------------addBalance-----------------------------------
 //Description: Adds balance to Player's total balance. Called after a round
 //             concludes and a Player wins. Positive numbers only.
@@ -110,6 +118,7 @@ bool Player::removeBalance(int amount)
   {
     this->balance -= amount;
   }
+  return true;
 } // end of removeBalance
 
 //----------------------------------addWin--------------------------------------
@@ -119,6 +128,7 @@ bool Player::removeBalance(int amount)
 bool Player::addWin()
 {
   this->wins++;
+  return true;
 } // end of addWin
 
 //----------------------------------getWins-------------------------------------
@@ -137,6 +147,7 @@ int Player::getWins() const
 bool Player::addLoss()
 {
   this->losses++;
+  return true;
 } // end of addLoss
  
 //----------------------------------getLosses-----------------------------------
@@ -148,50 +159,6 @@ int Player::getLosses() const
   return this->losses;
 } // end of getLosses
 
-//----------------------------------addCard-------------------------------------
-//Description: Adds a card to the Player's hand (vector of Card pointers).
-//Parameters:  - newCard: A pointer for a card.
-//------------------------------------------------------------------------------
-bool Player::addCard(Card* newCard)
-{
-  this->hand.push_back(newCard);
-  this->points += newCard->getValue();
-  return true;
-} // end of addCard
-
-//--------------------------------discardHand-----------------------------------
-//Description: Removes all cards from Player's hand and destroys the Card object.
-//Parameters:  N/A
-//------------------------------------------------------------------------------
-bool Player::discardHand()
-{
-  if (!hand.empty())
-  {
-    for (int i = 0; i < hand.size(); i++)
-    {
-      delete hand[i];
-      hand[i] = nullptr;
-    }
-    hand.clear();
-  }
-  this->points = 0;
-} // end of discardHand
-
-//------------------------------updateCardValues--------------------------------
-//Description: Updates the values of the cards in the Player's hand. This is
-//             called when a bustCheck in the Game object swaps the wild card
-//             value of Ace from 11 to 1.
-//Parameters:  N/A
-//------------------------------------------------------------------------------
-bool Player::updateCardValues()
-{
-  this->points = 0;
-  for (int i = 0; i < hand.size(); i++)
-  {
-    this->points += hand[i]->getValue();
-  }
-} // end of updateCardValues
-
 //--------------------------------operator<<------------------------------------
 //Description: Output operator overload to print the Player's name, their balance,
 //             and their numbers of wins and losses. Used by printStats in Game.
@@ -0,0 +1,199 @@
+//------------------------------PlayerPool.cpp----------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the implementation file for the PlayerPool class. It
+//             keeps the Player records of everyone who has played on the server
+//             in a fixed array of slots, so a player's balance, wins and losses
+//             carry over when they leave one table and sit at another. Seats
+//             check a record out by value when a player sits down and check it
+//             back in when they leave; no slot is allocated or freed while the
+//             server runs. Once every slot is taken, the record returned the
+//             longest time ago gives up its slot. The server keeps one pool
+//             shared by every Game, guarded by a mutex; given a Ledger, the pool
+//             checks out the ledger's record of a player it holds none of. The
+//             records are written to a snapshot image in the order they were
+//             checked in, and checked in again in that order when it is read.
+//------------------------------------------------------------------------------
+#include "PlayerPool.h"
+#include <algorithm>
+
+//--------------------------------PlayerPool------------------------------------
+//Description: Constructor for PlayerPool. Every slot starts free.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+PlayerPool::PlayerPool()
+{
+    pthread_mutex_init(&this->mtx, nullptr);
+    this->numFree = MAX_PLAYER_RECORDS;
+    this->clock = 0;
+    this->ledger = nullptr;
+    for (int i = 0; i < MAX_PLAYER_RECORDS; i++)
+    {
+        this->used[i] = false;
+        this->returned[i] = 0;
+        this->freeSlots[i] = MAX_PLAYER_RECORDS - 1 - i;
+    }
+} // end of PlayerPool
+
+//--------------------------------~PlayerPool-----------------------------------
+//Description: Destructor for PlayerPool.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+PlayerPool::~PlayerPool()
+{
+    pthread_mutex_destroy(&this->mtx);
+} // end of ~PlayerPool
+
+//---------------------------------checkOut-------------------------------------
+//Description: Public function that returns a copy of the specified player's
+//             record for their Seat, or the ledger's record if the pool has
+//             none, or a new Player with the default balance if neither does.
+//             The record stays in the pool until it is checked back in.
+//Parameters:  - username: Player sitting down.
+//------------------------------------------------------------------------------
+Player PlayerPool::checkOut(const string &username) const
+{
+    pthread_mutex_lock(&this->mtx);
+    int slot = findRecord(username);
+    Player player = slot < 0 ? Player(username) : this->records[slot];
+    pthread_mutex_unlock(&this->mtx);
+    if (slot < 0 && this->ledger != nullptr)
+    {
+        this->ledger->find(username, &player);
+    }
+    return player;
+} // end of checkOut
+
+//---------------------------------checkIn--------------------------------------
+//Description: Public function that stores a player's record as they leave
+//             their Seat, over their earlier record if the pool has one.
+//Parameters:  - player: Player leaving the table.
+//------------------------------------------------------------------------------
+void PlayerPool::checkIn(const Player &player)
+{
+    pthread_mutex_lock(&this->mtx);
+    int slot = findRecord(player.getName());
+    if (slot < 0)
+    {
+        slot = takeSlot();
+    }
+    this->records[slot] = player;
+    this->used[slot] = true;
+    this->returned[slot] = ++this->clock;
+    pthread_mutex_unlock(&this->mtx);
+} // end of checkIn
+
+//-------------------------------getNumRecords----------------------------------
+//Description: Public function that returns the number of records in the pool.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+int PlayerPool::getNumRecords() const
+{
+    pthread_mutex_lock(&this->mtx);
+    int numRecords = MAX_PLAYER_RECORDS - this->numFree;
+    pthread_mutex_unlock(&this->mtx);
+    return numRecords;
+} // end of getNumRecords
+
+//--------------------------------writeImage------------------------------------
+//Description: Public function that writes every record to a snapshot image,
+//             the one checked in the longest time ago first.
+//Parameters:  - image: Snapshot image to write to.
+//------------------------------------------------------------------------------
+void PlayerPool::writeImage(SnapshotWriter &image) const
+{
+    pthread_mutex_lock(&this->mtx);
+    int slots[MAX_PLAYER_RECORDS];
+    int numRecords = 0;
+    for (int i = 0; i < MAX_PLAYER_RECORDS; i++)
+    {
+        if (this->used[i])
+        {
+            slots[numRecords++] = i;
+        }
+    }
+    sort(slots, slots + numRecords, [this](int a, int b) { return this->returned[a] < this->returned[b]; });
+    image.put<int32_t>(numRecords);
+    for (int i = 0; i < numRecords; i++)
+    {
+        const Player &player = this->records[slots[i]];
+        image.putString(player.getName());
+        image.put<int32_t>(player.getBalance());
+        image.put<int32_t>(player.getWins());
+        image.put<int32_t>(player.getLosses());
+    }
+    pthread_mutex_unlock(&this->mtx);
+} // end of writeImage
+
+//--------------------------------findRecord------------------------------------
+//Description: Private function that returns the slot holding the specified
+//             player's record, or -1 if there is none. The mutex is held.
+//Parameters:  - username: Specified player.
+//------------------------------------------------------------------------------
+int PlayerPool::findRecord(const string &username) const
+{
+    for (int i = 0; i < MAX_PLAYER_RECORDS; i++)
+    {
+        if (this->used[i] && this->records[i].getName() == username)
+        {
+            return i;
+        }
+    }
+    return -1;
+} // end of findRecord
+
+//---------------------------------takeSlot-------------------------------------
+//Description: Private function that returns a free slot, or frees the slot of
+//             the record checked in the longest time ago when none are left.
+//             The mutex is held.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+int PlayerPool::takeSlot()
+{
+    if (this->numFree > 0)
+    {
+        return this->freeSlots[--this->numFree];
+    }
+    int oldest = 0;
+    for (int i = 1; i < MAX_PLAYER_RECORDS; i++)
+    {
+        if (this->returned[i] < this->returned[oldest])
+        {
+            oldest = i;
+        }
+    }
+    return oldest;
+} // end of takeSlot
+
+//--------------------------------setLedger-------------------------------------
+//Description: Public function that gives the pool the server's ledger to check
+//             out the records of players it holds none of.
+//Parameters:  - ledger: The server's ledger, or nullptr for none.
+//------------------------------------------------------------------------------
+void PlayerPool::setLedger(const Ledger* ledger)
+{
+    this->ledger = ledger;
+} // end of setLedger
+
+//---------------------------------readImage------------------------------------
+//Description: Public function that checks in every record writeImage wrote, in
+//             the order they were written. Returns false if the image doesn't
+//             hold them.
+//Parameters:  - image: Snapshot image, read up to the end of the pool's.
+//------------------------------------------------------------------------------
+bool PlayerPool::readImage(SnapshotReader &image)
+{
+    int numRecords = image.get<int32_t>();
+    for (int i = 0; i < numRecords && image.check(i < MAX_PLAYER_RECORDS); i++)
+    {
+        string username = image.getString();
+        int balance = image.get<int32_t>();
+        int wins = image.get<int32_t>();
+        int losses = image.get<int32_t>();
+        if (image.isValid())
+        {
+            checkIn(Player(username, balance, wins, losses));
+        }
+    }
+    return image.isValid();
+} // end of readImage
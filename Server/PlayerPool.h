@@ -0,0 +1,56 @@
+//-------------------------------PlayerPool.h-----------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the header file for the PlayerPool class. It keeps the
+//             Player records of everyone who has played on the server in a
+//             fixed array of slots, so a player's balance, wins and losses
+//             carry over when they leave one table and sit at another. Seats
+//             check a record out by value when a player sits down and check it
+//             back in when they leave; no slot is allocated or freed while the
+//             server runs. Once every slot is taken, the record returned the
+//             longest time ago gives up its slot. The server keeps one pool
+//             shared by every Game, guarded by a mutex; given a Ledger, the pool
+//             checks out the ledger's record of a player it holds none of. The
+//             records are written to a snapshot image in the order they were
+//             checked in, and checked in again in that order when it is read.
+//------------------------------------------------------------------------------
+#ifndef PLAYERPOOL_H
+#define PLAYERPOOL_H
+#include <string>
+#include <pthread.h>
+#include "Player.h"
+#include "Ledger.h"
+#include "Snapshot.h"
+using namespace std;
+
+static const int MAX_PLAYER_RECORDS = 256;  //Most players the pool remembers
+
+class PlayerPool
+{
+    private:
+        Player records[MAX_PLAYER_RECORDS];         //Player records, one per slot
+        bool used[MAX_PLAYER_RECORDS];              //Whether or not each slot holds a record
+        long long returned[MAX_PLAYER_RECORDS];     //When each record was last checked in
+        int freeSlots[MAX_PLAYER_RECORDS];          //Slots not holding a record
+        int numFree;                                //Number of free slots
+        long long clock;                            //Number of check ins so far
+        const Ledger* ledger;                       //Server's ledger, or nullptr to start unknown players afresh
+        mutable pthread_mutex_t mtx;                //Guards the pool for every table's thread
+        int findRecord(const string &username) const;
+        int takeSlot();
+
+    public:
+        //Constructors
+        PlayerPool();
+        ~PlayerPool();
+        //Getters
+        Player checkOut(const string &username) const;
+        int getNumRecords() const;
+        void writeImage(SnapshotWriter &image) const;
+
+        //Setters
+        void checkIn(const Player &player);
+        void setLedger(const Ledger* ledger);
+        bool readImage(SnapshotReader &image);
+};
+#endif
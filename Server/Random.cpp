@@ -0,0 +1,130 @@
+//---------------------------------Random.cpp-----------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the implementation file for the Random class, the seedable
+//             random number generator used to shuffle Decks and simulated Shoes.
+//             It is a 128 bit permuted congruential generator (PCG XSL RR
+//             128/64) that can jump ahead any number of draws in logarithmic
+//             time, which is used to split one seed into independent substreams.
+//------------------------------------------------------------------------------
+#include "Random.h"
+
+// Multiplier of the 128 bit linear congruential step
+static const uint128 MULTIPLIER = ((uint128) 0x2360ED051FC65DA4ULL << 64) | 0x4385DF649FCCF645ULL;
+// Draws between the starts of neighboring substreams
+static const uint128 SUBSTREAM_SPACING = (uint128) 1 << 64;
+
+//-----------------------------------Random-------------------------------------
+//Description: Constructor for Random. The same seed and stream always produce
+//             the same sequence.
+//Parameters:  - seed:   Starting point of the sequence.
+//             - stream: Selects one of 2^63 unrelated sequences.
+//------------------------------------------------------------------------------
+Random::Random(unsigned long long seed, unsigned long long stream)
+{
+    this->seed = seed;
+    this->state = 0;
+    this->increment = ((uint128) stream << 1) | 1;
+    step();
+    this->state += ((uint128) seed << 64) | seed;
+    step();
+} // end of Random
+
+//----------------------------------getSeed-------------------------------------
+//Description: Returns the seed the generator was created from.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+unsigned long long Random::getSeed() const
+{
+    return this->seed;
+} // end of getSeed
+
+//---------------------------------getState-------------------------------------
+//Description: Returns the generator's position in its sequence, which setState
+//             returns a generator of the same seed and stream to.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+uint128 Random::getState() const
+{
+    return this->state;
+} // end of getState
+
+//---------------------------------substream------------------------------------
+//Description: Returns a copy of the generator jumped ahead to the start of the
+//             given substream. Substreams never overlap unless one of them
+//             draws more than 2^64 numbers.
+//Parameters:  - index: Index of the substream (e.g. the shoe number).
+//------------------------------------------------------------------------------
+Random Random::substream(unsigned long long index) const
+{
+    Random copy(*this);
+    copy.advance(SUBSTREAM_SPACING * index);
+    return copy;
+} // end of substream
+
+//------------------------------------step--------------------------------------
+//Description: Private function to move the generator one step along its
+//             sequence.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+void Random::step()
+{
+    this->state = this->state * MULTIPLIER + this->increment;
+} // end of step
+
+//---------------------------------operator()-----------------------------------
+//Description: Returns the next 64 bit number in the sequence.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+Random::result_type Random::operator()()
+{
+    step();
+    unsigned long long mixed = (unsigned long long) (this->state >> 64) ^ (unsigned long long) this->state;
+    unsigned rotation = (unsigned) (this->state >> 122);
+    return (mixed >> rotation) | (mixed << ((64 - rotation) & 63));
+} // end of operator()
+
+//----------------------------------bounded-------------------------------------
+//Description: Returns a number in [0, bound) using a multiply instead of a
+//             divide. The bias is below 2^-40 for the bounds a shoe needs.
+//Parameters:  - bound: Upper bound, exclusive.
+//------------------------------------------------------------------------------
+unsigned long long Random::bounded(unsigned long long bound)
+{
+    return (unsigned long long) (((uint128) (*this)() * bound) >> 64);
+} // end of bounded
+
+//----------------------------------advance-------------------------------------
+//Description: Jumps the generator ahead by the given number of draws in
+//             logarithmic time, by squaring the congruential step.
+//Parameters:  - delta: Number of draws to skip.
+//------------------------------------------------------------------------------
+void Random::advance(uint128 delta)
+{
+    uint128 accMultiplier = 1;
+    uint128 accIncrement = 0;
+    uint128 curMultiplier = MULTIPLIER;
+    uint128 curIncrement = this->increment;
+    while (delta > 0)
+    {
+        if (delta & 1)
+        {
+            accMultiplier *= curMultiplier;
+            accIncrement = accIncrement * curMultiplier + curIncrement;
+        }
+        curIncrement = (curMultiplier + 1) * curIncrement;
+        curMultiplier *= curMultiplier;
+        delta >>= 1;
+    }
+    this->state = accMultiplier * this->state + accIncrement;
+} // end of advance
+
+//---------------------------------setState-------------------------------------
+//Description: Moves the generator to a position returned by getState, so it
+//             draws on from there.
+//Parameters:  - state: Position in the sequence.
+//------------------------------------------------------------------------------
+void Random::setState(uint128 state)
+{
+    this->state = state;
+} // end of setState
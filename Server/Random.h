@@ -0,0 +1,46 @@
+//----------------------------------Random.h------------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the header file for the Random class, the seedable random
+//             number generator used to shuffle Decks and simulated Shoes. It is
+//             a 128 bit permuted congruential generator (PCG XSL RR 128/64)
+//             containing its state and stream increment as private members. It
+//             can jump ahead any number of draws in logarithmic time, which is
+//             used to split one seed into independent substreams: substream i
+//             starts i * 2^64 draws into the sequence, so a shoe played from
+//             (seed, i) is the same no matter which thread plays it. It meets
+//             the requirements of a standard uniform random bit generator so it
+//             can be passed to std::shuffle.
+//------------------------------------------------------------------------------
+#ifndef RANDOM_H
+#define RANDOM_H
+using namespace std;
+
+typedef unsigned __int128 uint128;
+
+class Random
+{
+    private:
+        uint128 state;          // Current position in the sequence
+        uint128 increment;      // Odd increment selecting the stream
+        unsigned long long seed;// Seed the generator was created from
+        void step();
+
+    public:
+        typedef unsigned long long result_type;
+
+        // Constructors
+        Random(unsigned long long seed = 0, unsigned long long stream = 0);
+        // Getters
+        unsigned long long getSeed() const;
+        uint128 getState() const;
+        Random substream(unsigned long long index) const;
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return ~0ULL; }
+        // Setters
+        result_type operator()();
+        unsigned long long bounded(unsigned long long bound);
+        void advance(uint128 delta);
+        void setState(uint128 state);
+};
+#endif
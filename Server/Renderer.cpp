@@ -0,0 +1,194 @@
+//-------------------------------Renderer.cpp-----------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the implementation file for the Renderer class. It holds
+//             a fixed buffer that the table's text is written into, with the
+//             lines that never change kept as templates and each Card written
+//             from the glyph it was made with. The buffer is cleared and reused
+//             for every message, so rendering the hands or the scoreboard makes
+//             no calls into the global allocator. Text that would not fit is cut
+//             off at the buffer's capacity. The class is used within Game and is
+//             created by the Game class.
+//------------------------------------------------------------------------------
+#include "Renderer.h"
+
+static const char SPACES[] = "                                                ";
+static const size_t NUM_SPACES = sizeof(SPACES) - 1;
+static const int MAX_DIGITS = 20;   //Characters in the longest long long, sign included
+
+//---------------------------------formatInt------------------------------------
+//Description: Helper that writes the decimal digits of a number to the end of
+//             a buffer and returns where they start.
+//Parameters:  - value: Number to write.
+//             - end:   One past the last character of the buffer.
+//------------------------------------------------------------------------------
+static char* formatInt(long long value, char* end)
+{
+    unsigned long long digits = value < 0 ? 0ULL - value : value;
+    char* start = end;
+    do
+    {
+        *--start = '0' + digits % 10;
+        digits /= 10;
+    } while (digits != 0);
+    if (value < 0)
+    {
+        *--start = '-';
+    }
+    return start;
+} // end of formatInt
+
+//---------------------------------Renderer-------------------------------------
+//Description: Constructor for Renderer. Starts with an empty buffer.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+Renderer::Renderer()
+{
+    clear();
+} // end of Renderer
+
+//----------------------------------c_str---------------------------------------
+//Description: Public function that returns the text written, null terminated.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+const char* Renderer::c_str() const
+{
+    return this->text;
+} // end of c_str
+
+//-----------------------------------size---------------------------------------
+//Description: Public function that returns the bytes written.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+size_t Renderer::size() const
+{
+    return this->length;
+} // end of size
+
+//-----------------------------------str----------------------------------------
+//Description: Public function that returns a copy of the text written, for
+//             callers that still want a string.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+string Renderer::str() const
+{
+    return string(this->text, this->length);
+} // end of str
+
+//-----------------------------------clear--------------------------------------
+//Description: Public function that empties the buffer for the next message.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+void Renderer::clear()
+{
+    this->length = 0;
+    this->text[0] = '\0';
+} // end of clear
+
+//-----------------------------------append-------------------------------------
+//Description: Public function that writes characters to the end of the text,
+//             cutting them off at the buffer's capacity.
+//Parameters:  - chars: Characters to write.
+//             - count: Number of characters.
+//------------------------------------------------------------------------------
+void Renderer::append(const char* chars, size_t count)
+{
+    if (count > RENDER_CAPACITY - this->length)
+    {
+        count = RENDER_CAPACITY - this->length;
+    }
+    memcpy(this->text + this->length, chars, count);
+    this->length += count;
+    this->text[this->length] = '\0';
+} // end of append
+
+//-----------------------------------append-------------------------------------
+//Description: Public function that writes a null terminated template.
+//Parameters:  - chars: Characters to write.
+//------------------------------------------------------------------------------
+void Renderer::append(const char* chars)
+{
+    append(chars, strlen(chars));
+} // end of append
+
+//-----------------------------------append-------------------------------------
+//Description: Public function that writes a string.
+//Parameters:  - chars: Characters to write.
+//------------------------------------------------------------------------------
+void Renderer::append(const string &chars)
+{
+    append(chars.data(), chars.size());
+} // end of append
+
+//-----------------------------------append-------------------------------------
+//Description: Public function that writes a number in decimal.
+//Parameters:  - value: Number to write.
+//------------------------------------------------------------------------------
+void Renderer::append(long long value)
+{
+    char digits[MAX_DIGITS];
+    char* start = formatInt(value, digits + MAX_DIGITS);
+    append(start, digits + MAX_DIGITS - start);
+} // end of append
+
+//-----------------------------------append-------------------------------------
+//Description: Public function that writes a Card as it is printed by its
+//             output operator.
+//Parameters:  - card: Card to write.
+//------------------------------------------------------------------------------
+void Renderer::append(const Card &card)
+{
+    append(card.getGlyph(), card.getGlyphLength());
+} // end of append
+
+//--------------------------------appendPadded----------------------------------
+//Description: Public function that writes characters right aligned in a field,
+//             as setw does.
+//Parameters:  - chars: Characters to write.
+//             - count: Number of characters.
+//             - width: Width of the field.
+//------------------------------------------------------------------------------
+void Renderer::appendPadded(const char* chars, size_t count, size_t width)
+{
+    if (width > count)
+    {
+        appendSpaces(width - count);
+    }
+    append(chars, count);
+} // end of appendPadded
+
+//--------------------------------appendPadded----------------------------------
+//Description: Public function that writes a string right aligned in a field.
+//Parameters:  - chars: Characters to write.
+//             - width: Width of the field.
+//------------------------------------------------------------------------------
+void Renderer::appendPadded(const string &chars, size_t width)
+{
+    appendPadded(chars.data(), chars.size(), width);
+} // end of appendPadded
+
+//--------------------------------appendPadded----------------------------------
+//Description: Public function that writes a number right aligned in a field.
+//Parameters:  - value: Number to write.
+//             - width: Width of the field.
+//------------------------------------------------------------------------------
+void Renderer::appendPadded(long long value, size_t width)
+{
+    char digits[MAX_DIGITS];
+    char* start = formatInt(value, digits + MAX_DIGITS);
+    appendPadded(start, digits + MAX_DIGITS - start, width);
+} // end of appendPadded
+
+//--------------------------------appendSpaces----------------------------------
+//Description: Public function that writes a run of spaces.
+//Parameters:  - count: Number of spaces.
+//------------------------------------------------------------------------------
+void Renderer::appendSpaces(size_t count)
+{
+    while (count > NUM_SPACES)
+    {
+        append(SPACES, NUM_SPACES);
+        count -= NUM_SPACES;
+    }
+    append(SPACES, count);
+} // end of appendSpaces
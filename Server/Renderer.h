@@ -0,0 +1,49 @@
+//--------------------------------Renderer.h------------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the header file for the Renderer class. It holds a fixed
+//             buffer that the table's text is written into, with the lines that
+//             never change kept as templates and each Card written from the
+//             glyph it was made with. The buffer is cleared and reused for
+//             every message, so rendering the hands or the scoreboard makes no
+//             calls into the global allocator. Text that would not fit is cut
+//             off at the buffer's capacity. The class is used within Game and is
+//             created by the Game class.
+//------------------------------------------------------------------------------
+#ifndef RENDERER_H
+#define RENDERER_H
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include "card.h"
+using namespace std;
+
+static const size_t RENDER_CAPACITY = 8192;    //Bytes in the buffer, enough for every hand at a full table
+
+class Renderer
+{
+    private:
+        char text[RENDER_CAPACITY + 1];     //Text written so far, always null terminated
+        size_t length;                      //Bytes written since the last clear
+
+    public:
+        //Constructors
+        Renderer();
+        //Getters
+        const char* c_str() const;
+        size_t size() const;
+        string str() const;
+
+        //Setters
+        void clear();
+        void append(const char* chars, size_t count);
+        void append(const char* chars);
+        void append(const string &chars);
+        void append(long long value);
+        void append(const Card &card);
+        void appendPadded(const char* chars, size_t count, size_t width);
+        void appendPadded(const string &chars, size_t width);
+        void appendPadded(long long value, size_t width);
+        void appendSpaces(size_t count);
+};
+#endif
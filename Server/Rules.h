@@ -0,0 +1,98 @@
+//-----------------------------------Rules.h------------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the header file for the rule constants shared by Game's
+//             analytics and the headless simulator. Cards are reduced to ranks,
+//             1 (Ace) through 10 (10, J, Q and K), which is all the rules need
+//             to score a hand. Decisions are the actions a Player can take, in
+//             the same order as the ACTION values the client sends. A table's
+//             rule variant is a RulesPolicy: the number of decks, whether the
+//             dealer hits soft 17, double after split, late surrender, and the
+//             payout on a natural, all fixed at compile time so the simulator's
+//             engine is built once per variant with no rule checks left in its
+//             hot loop. TableRules describes a policy as plain values for Game,
+//             which picks its rules per table at runtime.
+//------------------------------------------------------------------------------
+#ifndef RULES_H
+#define RULES_H
+
+static const int BLACKJACK = 21;    //Best total, anything above is BUST
+static const int DEALER_STAND = 17; //Dealer stands on this total or higher (see Game::dealerActions)
+static const int ACE = 1;           //Rank of an Ace, counted as 11 when it doesn't BUST the hand
+static const int TEN = 10;          //Rank shared by 10, J, Q and K
+static const int NUM_RANKS = 10;    //Ranks from Ace to Ten
+static const int SOFT_BONUS = 10;   //Extra points when an Ace counts as 11
+static const int CARDS_PER_DECK = 52;  //Cards in a single deck
+static const int SUITS_PER_DECK = 4;   //Cards of each rank per deck, four times that for Ten
+
+//Rule variant of a table, every member a compile-time constant
+template <int Decks, bool HitSoft17, bool DoubleAfterSplit, bool LateSurrender, int NaturalPays, int NaturalPer>
+struct RulesPolicy
+{
+    static constexpr int DECKS = Decks;                         //Decks in the shoe
+    static constexpr bool HIT_SOFT_17 = HitSoft17;              //Whether or not the dealer hits a soft 17
+    static constexpr bool DOUBLE_AFTER_SPLIT = DoubleAfterSplit;    //Whether or not a split hand may double down
+    static constexpr bool LATE_SURRENDER = LateSurrender;       //Surrender only as the first action and not against a natural
+    static constexpr int NATURAL_PAYS = NaturalPays;            //A winning natural pays NATURAL_PAYS to NATURAL_PER
+    static constexpr int NATURAL_PER = NaturalPer;
+
+    //Whether or not the dealer draws to the given total
+    static constexpr bool dealerHits(int points, bool soft)
+    {
+        return points < DEALER_STAND || (HitSoft17 && soft && points == DEALER_STAND);
+    }
+
+    //Whether or not a Player may surrender at this point in the turn
+    static constexpr bool canSurrender(bool firstAction)
+    {
+        return firstAction || !LateSurrender;
+    }
+
+    //Winnings on a natural for the given bet, in the bet's units
+    static constexpr int naturalWin(int bet)
+    {
+        return bet * NaturalPays / NaturalPer;
+    }
+};
+
+using HouseRules = RulesPolicy<4, false, false, false, 1, 1>;      //The Server's table: S17, surrender any time, even money
+using StripRules = RulesPolicy<4, false, true, true, 3, 2>;        //S17, double after split, late surrender, 3:2
+using DowntownRules = RulesPolicy<6, true, true, true, 3, 2>;      //H17, double after split, late surrender, 3:2
+using SixFiveRules = RulesPolicy<6, true, false, true, 6, 5>;      //H17, late surrender, naturals pay 6:5
+
+//A RulesPolicy as plain values, for choosing the rules of a table at runtime
+struct TableRules
+{
+    const char* name;       //Name the rules are chosen by
+    int decks;              //Decks in the shoe
+    bool hitSoft17;         //Whether or not the dealer hits a soft 17
+    bool doubleAfterSplit;  //Whether or not a split hand may double down
+    bool lateSurrender;     //Surrender only as the first action and not against a natural
+    int naturalPays;        //A winning natural pays naturalPays to naturalPer
+    int naturalPer;
+};
+
+//Describe a RulesPolicy as TableRules under the given name
+template <class Rules>
+constexpr TableRules describeRules(const char* name)
+{
+    return TableRules{ name, Rules::DECKS, Rules::HIT_SOFT_17, Rules::DOUBLE_AFTER_SPLIT,
+        Rules::LATE_SURRENDER, Rules::NATURAL_PAYS, Rules::NATURAL_PER };
+}
+
+static const TableRules HOUSE_RULES = describeRules<HouseRules>("house");
+static const TableRules STRIP_RULES = describeRules<StripRules>("strip");
+static const TableRules DOWNTOWN_RULES = describeRules<DowntownRules>("downtown");
+static const TableRules SIX_FIVE_RULES = describeRules<SixFiveRules>("sixfive");
+
+//Every variant a table can be played by
+static const TableRules* const RULE_VARIANTS[] = { &HOUSE_RULES, &STRIP_RULES, &DOWNTOWN_RULES, &SIX_FIVE_RULES };
+
+enum class Decision : unsigned char
+{
+    STAND,
+    HIT,
+    SURRENDER,
+    DOUBLE_DOWN
+};
+#endif
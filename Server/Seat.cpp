@@ -2,11 +2,14 @@
 //Author: Johnathan Hewit
 //Team: LuckyNo13
 //Description: This is the implementation file for the Seat class. It contains the
-//             Player assigned to the Seat, their status (active or inactive),
-//             whether or not they've BUST or Surrendered, and the amount of
-//             of their bet as private members, and exposes functions to
-//             retrieve and modify those attributes. The Seat class is used
-//             within Game and is created by the Game class.
+//             Player assigned to the Seat and their status (active or inactive)
+//             as private members, and exposes functions to retrieve and modify
+//             those attributes.
+//             The Player is held by value, copied in from the server's
+//             PlayerPool when they sit down. The cards, bets and flags of the hands played from the Seat are
+//             kept in the Game's TableState, indexed by the Seat's position.
+//             The Seat class is used within Game and is created by the Game
+//             class.
 //------------------------------------------------------------------------------
 #include "Seat.h"
 
@@ -16,18 +19,15 @@
 //------------------------------------------------------------------------------
 Seat::Seat()
 {
-    this->playerSeated = nullptr;
     this->seatOccupied = false;
-    this->bust = false;
-    this->betAmount = 0;
 } // end of Seat
 
 //------------------------------------Seat--------------------------------------
 //Description: This is a full constructor and can only be used when the Seat is
 //             is being filled at the beginning of a game.
-//Parameters:  - N/A
+//Parameters:  - player: The Player seated.
 //------------------------------------------------------------------------------
-Seat::Seat(Player* player)
+Seat::Seat(const Player &player) : Seat()
 {
     seatPlayer(player);
 } // end of Seat
@@ -45,13 +45,11 @@ Seat::~Seat()
 } // end of ~Seat
 
 //----------------------------------seatPlayer----------------------------------
-//Description: Public function that seats a player in this Seat and sets that
-//             Player's status.
+//Description: Public function that seats a copy of a player's record in this
+//             Seat and sets that Player's status.
 //Parameters:  - player: The Player seated.
-//             - playerStatus: Flag for whether or not the Player is active
-//                             (eligible to play).
 //------------------------------------------------------------------------------
-bool Seat::seatPlayer(Player* player)
+bool Seat::seatPlayer(const Player &player)
 {
     if (!this->seatOccupied)
     {
@@ -64,13 +62,13 @@ bool Seat::seatPlayer(Player* player)
 
 //--------------------------------unseatPlayer----------------------------------
 //Description: Public function that removes the seated Player from the Seat.
+//             Their record is left in place until the next Player sits down.
 //Parameters:  - N/A
 //------------------------------------------------------------------------------
 bool Seat::unseatPlayer()
 {
     if (this->seatOccupied)
     {
-        delete playerSeated;
         this->seatOccupied = false;
         return true;
     }
@@ -87,75 +85,25 @@ bool Seat::isSeated() const
     return this->seatOccupied;
 } // end of isSeated
 
-//-----------------------------------hasBust------------------------------------
-//Description: Public function to return the flag of whether or not the Player
-//             has Bust.
-//Parameters:  - N/A
-//------------------------------------------------------------------------------
-bool Seat::hasBust() const
-{
-    return bust;
-} // end of hasBust
-
-//-----------------------------------setBust------------------------------------
-//Description: Public function to set the flag of whether or not the Player
-//             has Bust.
-//Parameters:  - busted: Flag for whether or not the Player has Bust.
-//------------------------------------------------------------------------------
-bool Seat::setBust(bool busted)
-{
-    this->bust = busted;
-} // end of setBust
-
 //---------------------------------getPlayer------------------------------------
 //Description: Public function to expose a pointer for the Player object in this
 //             Seat.
 //Parameters:  - N/A
 //------------------------------------------------------------------------------
-Player* Seat::getPlayer() const
+const Player* Seat::getPlayer() const
 {
-    return this->playerSeated;
+    return &this->playerSeated;
 } // end of getPlayer
 
-//-----------------------------------getBet-------------------------------------
-//Description: Public function to return the amount of the bet of the Player.
-//Parameters:  - N/A
-//------------------------------------------------------------------------------
-int Seat::getBet() const
-{
-    return this->betAmount;
-} // end of getBet
-
-//-----------------------------------setBet-------------------------------------
-//Description: Public function to set the amount of the bet for the Player.
-//Parameters:  - amount: The amount of the bet.
-//------------------------------------------------------------------------------
-bool Seat::setBet(int amount)
-{
-    this->betAmount = amount;
-    return true;
-} // end of setBet
-
-//--------------------------------hasSurrendered--------------------------------
-//Description: Public function to return the flag for whether or not the Player
-//             has Surrended.
-//Parameters:  - N/A
-//------------------------------------------------------------------------------
-bool Seat::hasSurrended() const
-{
-    return this->surrendered;
-} // end of hasSurrendered
-
-//----------------------------------setSurrender--------------------------------
-//Description: Public function to set the flag for whether or not the Player
-//             has Surrended.
+//---------------------------------getPlayer------------------------------------
+//Description: Public function to expose a pointer for the Player object in this
+//             Seat, so the Game can settle their bets.
 //Parameters:  - N/A
 //------------------------------------------------------------------------------
-bool Seat::setSurrender(bool status)
+Player* Seat::getPlayer()
 {
-    this->surrendered = status;
-    return true;
-} // end of setSurrender
+    return &this->playerSeated;
+} // end of getPlayer
 
 //--------------------------------operator<<------------------------------------
 //Description: Function to overload the output operator to return information
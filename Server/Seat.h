@@ -2,11 +2,11 @@
 //Author: Johnathan Hewit
 //Team: LuckyNo13
 //Description: This is the header file for the Seat class. It contains the
-//             Player assigned to the Seat, their status (active or inactive),
-//             whether or not they've BUST or Surrendered, and the amount of
-//             of their bet as private members, and exposes functions to
-//             retrieve and modify those attributes. The Seat class is used
-//             within Game and is created by the Game class.
+//             Player assigned to the Seat and their status (active or inactive)
+//             as private members, and exposes functions to retrieve and modify
+//             those attributes. The hands played from the Seat are kept in the
+//             Game's TableState. The Seat class is used within Game and is
+//             created by the Game class.
 //------------------------------------------------------------------------------
 #ifndef SEAT_H
 #define SEAT_H
@@ -21,29 +21,21 @@ class Seat
 {
     friend ostream &operator<<(ostream &, const Seat &);
     private:
-        Player* playerSeated;   //Player in the seat
+        Player playerSeated;    //Player in the seat
         bool seatOccupied;      //Whether or not a player is seated
-        bool surrendered;       //Whether or not the player has surrended
-        bool bust;              //Whether or not the player has bust
-        int betAmount;          //Amount of the current bet
 
     public:
         //Constructors
         Seat();
-        Seat(Player*);
+        Seat(const Player &player);
         ~Seat();
         //Getters
         bool isSeated() const;
-        bool hasBust() const;
-        bool hasSurrended() const;
-        int getBet() const;
-        Player* getPlayer() const;
+        const Player* getPlayer() const;
+        Player* getPlayer();
 
         //Setters
-        bool seatPlayer(Player*);
+        bool seatPlayer(const Player &player);
         bool unseatPlayer();
-        bool setBust(bool busted);
-        bool setBet(int amount);
-        bool setSurrender(bool status);
 };
-#endif
\ No newline at end of file
+#endif
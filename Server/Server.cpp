@@ -2,6 +2,8 @@
 //Description:
 //------------------------------------------------------------------------------
 
+#include <random>
+#include <signal.h>
 #include "Driver.h"
 
 #pragma region Globals
@@ -30,6 +32,42 @@ std::map<int, Driver*> dMap;
 */
 int id{0}, games{0};
 
+/*
+* Session token generator, guarded by the id mutex
+*/
+std::mt19937_64 tokens{std::random_device{}()};
+
+/*
+* Bot seats each new game keeps filled, set on the command line
+*/
+int botSeats{0};
+
+/*
+* Rules every new game is played by, set on the command line
+*/
+const TableRules* tableRules{&HOUSE_RULES};
+
+/*
+* Records of every player who has sat at a table, shared by all games
+*/
+PlayerPool playerPool;
+
+/*
+* Log every game appends its rounds to, set on the command line
+*/
+HandHistory* handHistory{nullptr};
+
+/*
+* Ledger every game posts its players' records to, set on the command line
+*/
+Ledger* ledger{nullptr};
+
+/*
+* Snapshot every game is saved to when the server is stopped
+* and restored from when it starts, set on the command line
+*/
+std::string snapshotFile;
+
 #pragma endregion
 
 /*
@@ -260,6 +298,28 @@ bool invalidUserName(const NewPlayer* player) {
 	return invalid;
 }
 
+/*
+* Session token generator (never Session::NONE)
+*/
+Token nextToken() {
+	Token next;
+	lockId();
+	do {
+		next = tokens();
+	}
+	while (next == Session::NONE);
+	unlockId();
+	return next;
+}
+
+/*
+* Issue the new player a session token for reconnecting
+*/
+void issueToken(NewPlayer* player) {
+	player->token = nextToken();
+	writeTo(player->sock, &player->token, sizeof(Token));
+}
+
 /*
 * Register new player with a username
 */
@@ -269,6 +329,47 @@ void registerPlayer(NewPlayer* player) {
 		readUserName(player);
 	}
 	while (invalidUserName(player));
+	issueToken(player);
+}
+
+#pragma endregion
+
+#pragma region Session
+
+/*
+* Return the Driver whose game holds the session token
+*/
+Driver* findSession(const Token* token) {
+
+	lockMap();
+	std::map<int, Driver*> copy{dMap};
+	unlockMap();
+
+	for (const auto mapping : copy) {
+		if (!mapping.second->gameOver() && mapping.second->hasSession(token)) {
+			return mapping.second;
+		}
+	}
+	return nullptr;
+}
+
+/*
+* Read the session token sent by client, reattach the player
+* to their seat if it belongs to a player still in a game,
+* the Driver tells them they resumed
+*/
+bool resumeSession(NewPlayer* player) {
+
+	if (!tryReadFrom(player->sock, &player->token, sizeof(Token))) {
+		end(player->sock);
+	}
+
+	Driver* driver = player->token == Session::NONE ? nullptr : findSession(&player->token);
+	bool resumed = driver && driver->reattach(player);
+	if (!resumed) {
+		writeTo(player->sock, false);
+	}
+	return resumed;
 }
 
 #pragma endregion
@@ -347,11 +448,23 @@ int nextId() {
 }
 
 /*
-* Create new game with new player
+* Read the rules the new game's creator chose, by their index in
+* the rule variants, the server's rules for any other index
+*/
+const TableRules* readGameRules(const NewPlayer* player) {
+
+	int variant = readFrom(player->sock);
+	bool chosen = variant >= 0 && variant < (int) (sizeof(RULE_VARIANTS) / sizeof(RULE_VARIANTS[0]));
+	return chosen ? RULE_VARIANTS[variant] : tableRules;
+}
+
+/*
+* Create new game with new player, played by the rules they chose
 */
 void newGame(NewPlayer* player) {
 
-	DriverMapping mapping{player->gameId = nextId(), new Driver{player}};
+	const TableRules* rules = readGameRules(player);
+	DriverMapping mapping{player->gameId = nextId(), new Driver{player, botSeats, rules, &playerPool, handHistory, ledger}};
 	addToQ(&mapping);
 	addToMap(&mapping);
 }
@@ -375,6 +488,22 @@ bool canJoin(const NewPlayer* player) {
 	return driver && !driver->gameOver() && driver->addPlayer(player);
 }
 
+/*
+* Attach the new player to a game's event stream as a spectator,
+* the Driver's broadcast confirms once the player is watching
+*/
+bool watchGame(NewPlayer* player) {
+
+	readGameId(player);
+	Driver* driver = getDriver(player->gameId);
+	bool watching = driver && !driver->gameOver() && driver->addWatcher(player->sock);
+
+	if (!watching) {
+		writeTo(player->sock, false);
+	}
+	return watching;
+}
+
 /*
 * Add new player to an existing game
 */
@@ -382,6 +511,10 @@ bool joinGame(NewPlayer* player) {
 
 	bool joined{true};
 
+	if (player->gameId == Default::WATCH_ID) {
+		return watchGame(player);
+	}
+
 	if (player->gameId == Default::CREATE_ID) {
 		newGame(player);
 	}
@@ -409,7 +542,8 @@ void chooseGame(NewPlayer* player) {
 #pragma endregion
 
 /*
-* Register new player with a unique username,
+* Resume a returning player's session or
+* register new player with a unique username,
 * display all available games,
 * add new player to existing game or
 * create a new game for new player
@@ -417,8 +551,10 @@ void chooseGame(NewPlayer* player) {
 void* newPlayer(void* arg) {
 
 	NewPlayer player{(int*) arg};
-	registerPlayer(&player);
-	chooseGame(&player);
+	if (!resumeSession(&player)) {
+		registerPlayer(&player);
+		chooseGame(&player);
+	}
 	pthread_exit(nullptr);
 }
 
@@ -431,14 +567,207 @@ void runNewPlayer(int newFd) {
 
 #pragma endregion
 
+#pragma region Snapshot
+
+/*
+* Signals that stop the server once the snapshot is saved
+*/
+sigset_t stopSignals() {
+
+	sigset_t signals;
+	sigemptyset(&signals);
+	sigaddset(&signals, SIGTERM);
+	sigaddset(&signals, SIGINT);
+	return signals;
+}
+
+/*
+* Save every game's image at its last round boundary, the id generator
+* and the player records to the snapshot file, each game is frozen and
+* its image taken once its thread is parked or waiting on its players,
+* it parks before it could settle another bet
+*/
+bool saveSnapshot() {
+
+	SnapshotWriter snapshot, tables;
+	int count{0};
+
+	// Never unlocked, no game is added or removed from here on
+	lockMap();
+	for (const auto mapping : dMap) {
+		count += mapping.second->freeze(&tables);
+	}
+
+	snapshot.put(SNAPSHOT_MAGIC);
+	snapshot.put(SNAPSHOT_VERSION);
+	lockId();
+	snapshot.put<int32_t>(id);
+	unlockId();
+	snapshot.put<int32_t>(count);
+	snapshot.putImage(tables);
+	playerPool.writeImage(snapshot);
+	return snapshot.save(snapshotFile);
+}
+
+/*
+* Wait for a stop signal, save the snapshot and exit once the
+* hand history and ledger have written out everything they hold,
+* no game writes to them again once every game is frozen
+*/
+void* snapshotter(void*) {
+
+	sigset_t signals{stopSignals()};
+	int sig;
+	sigwait(&signals, &sig);
+
+	bool saved = saveSnapshot();
+	delete handHistory;
+	delete ledger;
+	exit(saved ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+/*
+* Start thread to save the snapshot when the server is stopped
+*/
+void runSnapshotter() {
+	if (!snapshotFile.empty()) {
+		runThread(snapshotter, 0);
+	}
+}
+
+/*
+* Restore every game, the id generator and the player records from the
+* snapshot file, its players reconnect to their seats with their session
+* tokens, the file is removed once restored so it is never restored twice
+*/
+void restoreSnapshot() {
+
+	std::string bytes;
+	if (snapshotFile.empty() || !SnapshotReader::load(snapshotFile, &bytes)) {
+		return;
+	}
+
+	SnapshotReader snapshot{bytes};
+	snapshot.check(snapshot.get<uint32_t>() == SNAPSHOT_MAGIC);
+	snapshot.check(snapshot.get<uint32_t>() == SNAPSHOT_VERSION);
+	int nextId = snapshot.get<int32_t>(), count = snapshot.get<int32_t>();
+	SnapshotReader tables{snapshot.getImage()};
+
+	std::vector<DriverMapping> restored;
+	for (int i = 0; i < count && tables.isValid(); i++) {
+		SnapshotReader table{tables.getImage()};
+		Driver* driver = new Driver{&table, &playerPool, handHistory, ledger};
+		if (table.check(table.atEnd() && driver->gameId() < nextId)) {
+			restored.emplace_back(driver->gameId(), driver);
+		}
+		tables.check(table.isValid());
+	}
+	playerPool.readImage(snapshot);
+
+	if (!snapshot.check(tables.isValid() && tables.atEnd() && snapshot.atEnd())) {
+		gracefulExit(Bad::SNAPSHOT);
+	}
+	id = nextId;
+	for (const auto& mapping : restored) {
+		addToQ(&mapping);
+		addToMap(&mapping);
+	}
+	remove(snapshotFile.c_str());
+}
+
+#pragma endregion
+
+/*
+* Read the number of bot seats per game from the command line
+*/
+void readBotSeats(int argc, char* argv[]) {
+
+	if (argc > 1) {
+		botSeats = atoi(argv[1]);
+		if (botSeats < 0 || botSeats > Bot::MAX) {
+			gracefulExit(Bad::SERVER_ARG);
+		}
+	}
+}
+
+/*
+* Read the rules a game is played by when its creator doesn't
+* choose any from the command line
+*/
+void readTableRules(int argc, char* argv[]) {
+
+	if (argc > 2) {
+		tableRules = nullptr;
+		for (const TableRules* variant : RULE_VARIANTS) {
+			if (strcmp(argv[2], variant->name) == 0) {
+				tableRules = variant;
+			}
+		}
+		if (!tableRules) {
+			gracefulExit(Bad::SERVER_ARG);
+		}
+	}
+}
+
+/*
+* Open the hand history log named on the command line
+*/
+void readHandHistory(int argc, char* argv[]) {
+
+	if (argc > 3) {
+		handHistory = new HandHistory{argv[3]};
+		if (!handHistory->isOpen()) {
+			gracefulExit(Bad::SERVER_ARG);
+		}
+	}
+}
+
+/*
+* Open the player ledger named on the command line,
+* recovering every balance it holds
+*/
+void readLedger(int argc, char* argv[]) {
+
+	if (argc > 4) {
+		ledger = new Ledger{argv[4]};
+		if (!ledger->isOpen()) {
+			gracefulExit(Bad::SERVER_ARG);
+		}
+		playerPool.setLedger(ledger);
+	}
+}
+
+/*
+* Read the snapshot file named on the command line, the stop signals
+* are blocked before any thread starts so only the snapshotter takes them
+*/
+void readSnapshotFile(int argc, char* argv[]) {
+
+	if (argc > 5) {
+		snapshotFile = argv[5];
+		sigset_t signals{stopSignals()};
+		pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+	}
+}
+
 /*
-* Create a TCP connection request socket,
+* Read the bot seats, rules per game, hand history log, player ledger
+* and snapshot file, restore the games saved in the snapshot,
+* create a TCP connection request socket,
 * create a thread for each connection request,
 * register the new player and new socket in the thread
 */
-int main() {
+int main(int argc, char* argv[]) {
 
+	readSnapshotFile(argc, argv);
+	readBotSeats(argc, argv);
+	readTableRules(argc, argv);
+	readHandHistory(argc, argv);
+	readLedger(argc, argv);
+	restoreSnapshot();
+	signal(SIGPIPE, SIG_IGN);
 	runGameStarter();
+	runSnapshotter();
 
 	int requestFd = tcpConnectRequestSock(), newFd;
 	sockaddr_in newAddr;
@@ -0,0 +1,219 @@
+//--------------------------------Snapshot.cpp----------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the implementation file for the SnapshotWriter and
+//             SnapshotReader classes. A snapshot is saved to a new file that is
+//             synced and renamed over the old one, so a server stopped while
+//             saving it leaves the last whole snapshot or none, never half of
+//             one.
+//------------------------------------------------------------------------------
+#include "Snapshot.h"
+
+//--------------------------------getBytes--------------------------------------
+//Description: Public function that returns the image written so far.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+const string &SnapshotWriter::getBytes() const
+{
+    return this->bytes;
+} // end of getBytes
+
+//-----------------------------------save---------------------------------------
+//Description: Public function that writes the image to a new file, syncs it
+//             and renames it over the given path. Returns false if it can't.
+//Parameters:  - path: Path of the snapshot.
+//------------------------------------------------------------------------------
+bool SnapshotWriter::save(const string &path) const
+{
+    string temporary = path + ".tmp";
+    int out = open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (out < 0)
+    {
+        perror("open() failure");
+        return false;
+    }
+    const char* data = this->bytes.data();
+    size_t size = this->bytes.size();
+    bool written = true;
+    while (size > 0 && written)
+    {
+        ssize_t count = write(out, data, size);
+        if (count < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (count <= 0)
+        {
+            perror("write() failure");
+            written = false;
+        }
+        else
+        {
+            data += count;
+            size -= count;
+        }
+    }
+    if (written && fsync(out) != 0)
+    {
+        perror("fsync() failure");
+        written = false;
+    }
+    close(out);
+    if (written && rename(temporary.c_str(), path.c_str()) != 0)
+    {
+        perror("rename() failure");
+        written = false;
+    }
+    if (!written)
+    {
+        remove(temporary.c_str());
+        return false;
+    }
+    size_t slash = path.rfind('/');
+    int directory = open(slash == string::npos ? "." : path.substr(0, slash + 1).c_str(), O_RDONLY);
+    if (directory >= 0)
+    { //Make the rename itself durable
+        fsync(directory);
+        close(directory);
+    }
+    return true;
+} // end of save
+
+//--------------------------------putString-------------------------------------
+//Description: Public function that writes a string as its length and bytes.
+//Parameters:  - text: String to write.
+//------------------------------------------------------------------------------
+void SnapshotWriter::putString(const string &text)
+{
+    put<uint32_t>(text.size());
+    this->bytes.append(text);
+} // end of putString
+
+//---------------------------------putImage-------------------------------------
+//Description: Public function that writes another image as its length and
+//             bytes.
+//Parameters:  - image: Image to write.
+//------------------------------------------------------------------------------
+void SnapshotWriter::putImage(const SnapshotWriter &image)
+{
+    putString(image.bytes);
+} // end of putImage
+
+//-----------------------------------clear--------------------------------------
+//Description: Public function that empties the image, keeping its storage for
+//             the next one.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+void SnapshotWriter::clear()
+{
+    this->bytes.clear();
+} // end of clear
+
+//-------------------------------SnapshotReader---------------------------------
+//Description: Constructor for SnapshotReader.
+//Parameters:  - bytes: The image to read.
+//------------------------------------------------------------------------------
+SnapshotReader::SnapshotReader(const string &bytes)
+{
+    this->bytes = bytes;
+    this->next = 0;
+    this->valid = true;
+} // end of SnapshotReader
+
+//-----------------------------------load---------------------------------------
+//Description: Function that reads a whole snapshot file. Returns false if
+//             there is none or it can't be read.
+//Parameters:  - path:  Path of the snapshot.
+//             - bytes: Set to the file's contents.
+//------------------------------------------------------------------------------
+bool SnapshotReader::load(const string &path, string* bytes)
+{
+    int in = open(path.c_str(), O_RDONLY);
+    if (in < 0)
+    {
+        if (errno != ENOENT)
+        {
+            perror("open() failure");
+        }
+        return false;
+    }
+    bytes->clear();
+    char buffer[1 << 16];
+    ssize_t count;
+    while ((count = read(in, buffer, sizeof(buffer))) != 0)
+    {
+        if (count < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (count < 0)
+        {
+            perror("read() failure");
+            close(in);
+            return false;
+        }
+        bytes->append(buffer, count);
+    }
+    close(in);
+    return true;
+} // end of load
+
+//---------------------------------isValid--------------------------------------
+//Description: Public function that returns whether or not every read so far
+//             succeeded.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+bool SnapshotReader::isValid() const
+{
+    return this->valid;
+} // end of isValid
+
+//----------------------------------atEnd---------------------------------------
+//Description: Public function that returns whether or not the whole image has
+//             been read.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+bool SnapshotReader::atEnd() const
+{
+    return this->next == this->bytes.size();
+} // end of atEnd
+
+//--------------------------------getString-------------------------------------
+//Description: Public function that reads a string written by putString.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+string SnapshotReader::getString()
+{
+    uint32_t size = get<uint32_t>();
+    if (!check(this->bytes.size() - this->next >= size))
+    {
+        return string();
+    }
+    string text = this->bytes.substr(this->next, size);
+    this->next += size;
+    return text;
+} // end of getString
+
+//---------------------------------getImage-------------------------------------
+//Description: Public function that reads an image written by putImage, for a
+//             reader of its own; a bad outer image gives a bad inner one.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+SnapshotReader SnapshotReader::getImage()
+{
+    SnapshotReader image(getString());
+    image.valid = this->valid;
+    return image;
+} // end of getImage
+
+//-----------------------------------check--------------------------------------
+//Description: Public function that marks the image bad unless a condition on
+//             what was read holds. Returns whether or not the image is still
+//             good.
+//Parameters:  - condition: What has to hold for the image to be good.
+//------------------------------------------------------------------------------
+bool SnapshotReader::check(bool condition)
+{
+    this->valid = this->valid && condition;
+    return this->valid;
+} // end of check
@@ -0,0 +1,83 @@
+//---------------------------------Snapshot.h-----------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the header file for the SnapshotWriter and SnapshotReader
+//             classes. A snapshot is the state of every table on the server as
+//             one compact binary image, written as the server is stopped and
+//             read back as it starts, so the games carry on where they were and
+//             their players reconnect to their seats. Numbers are written as
+//             their bytes in the host's order and strings as a 32 bit length
+//             and their bytes; an image nested in another, like each table's,
+//             is written with its length first so a reader can skip past it.
+//             The reader checks every read against the end of the image and
+//             what it read against what the image can hold; after the first
+//             read that fails it reads nothing more and the image is bad.
+//------------------------------------------------------------------------------
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cstdio>
+#include <cerrno>
+#include <string>
+#include <fcntl.h>
+#include <unistd.h>
+using namespace std;
+
+static const uint32_t SNAPSHOT_MAGIC = 0x534A4242;  //"BBJS", starts every snapshot
+static const uint32_t SNAPSHOT_VERSION = 1;         //Layout of the snapshot, changed with what it holds
+
+class SnapshotWriter
+{
+    private:
+        string bytes;                               //The image written so far
+
+    public:
+        //Getters
+        const string &getBytes() const;
+        bool save(const string &path) const;
+
+        //Setters
+        template <class T>
+        void put(const T &value)
+        {
+            this->bytes.append((const char*) &value, sizeof(T));
+        }
+        void putString(const string &text);
+        void putImage(const SnapshotWriter &image);
+        void clear();
+};
+
+class SnapshotReader
+{
+    private:
+        string bytes;                               //The image being read
+        size_t next;                                //Offset of the next value
+        bool valid;                                 //Whether or not every read so far succeeded
+
+    public:
+        //Constructors
+        SnapshotReader(const string &bytes);
+        static bool load(const string &path, string* bytes);
+        //Getters
+        bool isValid() const;
+        bool atEnd() const;
+
+        //Setters
+        template <class T>
+        T get()
+        {
+            T value{};
+            if (check(this->bytes.size() - this->next >= sizeof(T)))
+            {
+                memcpy(&value, this->bytes.data() + this->next, sizeof(T));
+                this->next += sizeof(T);
+            }
+            return value;
+        }
+        string getString();
+        SnapshotReader getImage();
+        bool check(bool condition);
+};
+#endif
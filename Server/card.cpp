@@ -3,8 +3,9 @@
 //Team: LuckyNo13
 //Description: This is the implentation file for the Card Class. It contains the value,
 //             suit, face type, and a flag for whether or not the card is visible
-//             as private members, and exposes functions to retrieve and adjust those
-//             attributes. The class is used within Decks and Players/Dealer hands
+//             as private members, along with the glyph it is printed as, built
+//             once when the card is made, and exposes functions to retrieve and
+//             adjust those attributes. The class is used within Decks and Players/Dealer hands
 //             and is created by the Deck class.
 //------------------------------------------------------------------------------
 #include "card.h"
@@ -21,6 +22,7 @@ Card::Card(const string &suit, const string &face, const int &pointValue)
   this->face = face;
   this->pointValue = pointValue;
   visible = false;
+  makeGlyph();
 } // end of Card()
 
 //---------------------------------Card()---------------------------------------
@@ -33,6 +35,8 @@ Card::Card(const Card &card)
   this->face = card.getFace();
   this->pointValue = card.getValue();
   this->visible = card.isVisible();
+  memcpy(this->glyph, card.glyph, CARD_GLYPH_SIZE);
+  this->glyphLength = card.glyphLength;
 } // end of Card()
 
 //--------------------------------~Card()---------------------------------------
@@ -55,7 +59,7 @@ int Card::getValue() const
 //Description: Returns the face for the card.
 //Parameters:  N/A
 //------------------------------------------------------------------------------
-string Card::getFace() const
+const string &Card::getFace() const
 {
   return this->face;
 } // end of getFace
@@ -64,7 +68,7 @@ string Card::getFace() const
 //Description: Returns the suit for the card.
 //Parameters:  N/A
 //------------------------------------------------------------------------------
-string Card::getSuit() const
+const string &Card::getSuit() const
 {
   return this->suit;
 } // end of getSuit
@@ -94,8 +98,40 @@ void Card::flip()
   }
 } // end of flip
 
+//-------------------------------getGlyph---------------------------------------
+//Description: Returns the card as it is printed, null terminated.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+const char* Card::getGlyph() const
+{
+  return this->glyph;
+} // end of getGlyph
+
+//----------------------------getGlyphLength------------------------------------
+//Description: Returns the number of bytes in the card's glyph.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+int Card::getGlyphLength() const
+{
+  return this->glyphLength;
+} // end of getGlyphLength
+
+//------------------------------makeGlyph---------------------------------------
+//Description: Private function that builds the glyph the card is printed as
+//             from its face and suit.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+void Card::makeGlyph()
+{
+  string text = "[ " + this->face + this->suit + " ]";
+  this->glyphLength = min<int>(text.size(), CARD_GLYPH_SIZE - 1);
+  memcpy(this->glyph, text.data(), this->glyphLength);
+  this->glyph[this->glyphLength] = '\0';
+} // end of makeGlyph
+
 //-------------------------------setValue---------------------------------------
-//Description: Flips the card over making visible hidden and vise versa.
+//Description: Sets the point value of an Ace to 11 or 1. Returns false for
+//             any other card.
 //Parameters:  - value: The new value of the card; only applies to the Ace.
 //------------------------------------------------------------------------------
 bool Card::setValue(int value)
@@ -105,6 +141,7 @@ bool Card::setValue(int value)
     return false;
   }
   this->pointValue = value;
+  return true;
 } // end of setValue
 
 //-------------------------------operator<<-------------------------------------
@@ -113,5 +150,5 @@ bool Card::setValue(int value)
 //------------------------------------------------------------------------------
 ostream &operator<<(ostream &output, const Card &card)
 {
-  return (output << "[ " << card.face << card.suit << " ]");
+  return output.write(card.glyph, card.glyphLength);
 } // end of operator<<
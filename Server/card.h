@@ -3,8 +3,9 @@
 //Team: LuckyNo13
 //Description: This is the header file for the Card Class. It contains the value,
 //             suit, face type, and a flag for whether or not the card is visible
-//             as private members, and exposes functions to retrieve and adjust those
-//             attributes. The class is used within Decks and Players/Dealer hands
+//             as private members, along with the glyph it is printed as, built
+//             once when the card is made, and exposes functions to retrieve and
+//             adjust those attributes. The class is used within Decks and Players/Dealer hands
 //             and is created by the Deck class.
 //------------------------------------------------------------------------------
 #ifndef CARD_H
@@ -13,8 +14,12 @@
 #include <fstream>
 #include <string>
 #include <vector>
+#include <cstring>
+#include <algorithm>
 using namespace std;
 
+static const int CARD_GLYPH_SIZE = 16;  //Bytes for "[ " face suit " ]", the suit in UTF-8, and a null
+
 class Card
 {
     friend ostream &operator<<(ostream &, const Card &);
@@ -23,6 +28,9 @@ class Card
       int pointValue;     // Points value of a card
       string suit;        // Suit value of a card (e.g: Hearts or Spades)
       bool visible;       // Whether or not the card is visible
+      char glyph[CARD_GLYPH_SIZE];  // The card as it is printed, e.g: [ 10♥ ]
+      int glyphLength;    // Bytes in the glyph
+      void makeGlyph();
 
     public:
       // Constructors
@@ -31,9 +39,11 @@ class Card
       ~Card();
       // Getters
       int getValue() const;
-      string getFace() const;
-      string getSuit() const;
+      const string &getFace() const;
+      const string &getSuit() const;
       bool isVisible() const;
+      const char* getGlyph() const;
+      int getGlyphLength() const;
       // Setters
       void flip();
       bool setValue(int value);
@@ -0,0 +1,67 @@
+//--------------------------------Betting.cpp-----------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the implementation file for the BettingSystem classes
+//             used by the simulator's bankroll sessions. Each sizes the next
+//             bet from the state of the session; the Simulation clamps it to
+//             Game's table limits and the bankroll.
+//------------------------------------------------------------------------------
+#include "Betting.h"
+#include "Game.h"
+
+//-------------------------------~BettingSystem---------------------------------
+//Description: Destructor for a BettingSystem.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+BettingSystem::~BettingSystem()
+{
+} // end of ~BettingSystem
+
+//-----------------------------------getBet-------------------------------------
+//Description: Always bets the table minimum.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+int FlatBetting::getBet(const BettingState &) const
+{
+    return MINIMUM_BET;
+} // end of getBet
+
+//-----------------------------------getBet-------------------------------------
+//Description: Bets one minimum unit at a true count of 1 or less and one more
+//             unit per point above that, up to the table maximum.
+//Parameters:  - state: State of the session.
+//------------------------------------------------------------------------------
+int CountRamp::getBet(const BettingState &state) const
+{
+    int units = (int) state.trueCount;
+    return MINIMUM_BET * max(1, units);
+} // end of getBet
+
+//-----------------------------------getBet-------------------------------------
+//Description: Doubles the last bet after a loss and goes back to the minimum
+//             after a win. A push bets the same again.
+//Parameters:  - state: State of the session.
+//------------------------------------------------------------------------------
+int Martingale::getBet(const BettingState &state) const
+{
+    if (state.lastBet == 0 || state.lastNet > 0)
+    {
+        return MINIMUM_BET;
+    }
+    return state.lastNet < 0 ? state.lastBet * 2 : state.lastBet;
+} // end of getBet
+
+//-----------------------------------getBet-------------------------------------
+//Description: Doubles the last bet after a win, up to PAROLI_WINS wins in a row,
+//             and goes back to the minimum after a loss or a finished run. A
+//             push bets the same again.
+//Parameters:  - state: State of the session.
+//------------------------------------------------------------------------------
+int Paroli::getBet(const BettingState &state) const
+{
+    if (state.lastBet == 0 || state.lastNet < 0 || state.streak >= PAROLI_WINS)
+    {
+        return MINIMUM_BET;
+    }
+    return state.lastNet > 0 ? state.lastBet * 2 : state.lastBet;
+} // end of getBet
@@ -0,0 +1,62 @@
+//---------------------------------Betting.h------------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the header file for the BettingSystem classes used by the
+//             simulator's bankroll sessions. BettingSystem is the interface a
+//             simulated Player implements to size the next bet from the state
+//             of the session: the bankroll, the last bet and its result, the
+//             current winning streak, and the true count of the shoe.
+//             FlatBetting always bets the minimum, CountRamp raises the bet one
+//             unit per point of true count, Martingale doubles after a loss and
+//             Paroli doubles after a win. Bets are clamped to Game's
+//             MINIMUM_BET..MAXIMUM_BET and to the bankroll by the Simulation.
+//             The systems hold no state of their own, so one can be shared by
+//             every Runner worker.
+//------------------------------------------------------------------------------
+#ifndef BETTING_H
+#define BETTING_H
+using namespace std;
+
+static const int PAROLI_WINS = 3;   //Wins in a row Paroli lets ride before starting over
+
+struct BettingState
+{
+    int bankroll;       //Dollars left in the session
+    int lastBet;        //Dollars bet on the last round, 0 before the first
+    int lastNet;        //Dollars won (or lost, if negative) on the last round
+    int streak;         //Rounds won in a row
+    double trueCount;   //True count of the shoe the next round is dealt from
+};
+
+class BettingSystem
+{
+    public:
+        virtual ~BettingSystem();
+        //Dollars to bet on the next round, before clamping
+        virtual int getBet(const BettingState &state) const = 0;
+};
+
+class FlatBetting : public BettingSystem
+{
+    public:
+        int getBet(const BettingState &state) const;
+};
+
+class CountRamp : public BettingSystem
+{
+    public:
+        int getBet(const BettingState &state) const;
+};
+
+class Martingale : public BettingSystem
+{
+    public:
+        int getBet(const BettingState &state) const;
+};
+
+class Paroli : public BettingSystem
+{
+    public:
+        int getBet(const BettingState &state) const;
+};
+#endif
@@ -0,0 +1,179 @@
+//------------------------------Comparison.cpp----------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the implementation file for the Comparison class used by
+//             the headless simulator. It accumulates rounds that every compared
+//             Strategy played from the same cards: the sum and sum of squares
+//             of each Strategy's net result per round, and the sum of squares
+//             of each Strategy's difference from the first (the baseline).
+//             Standard errors are taken over rounds, since the seats of one
+//             round share the dealer's hand and are not independent.
+//------------------------------------------------------------------------------
+#include "Comparison.h"
+
+//---------------------------------Comparison-----------------------------------
+//Description: Constructor for an empty Comparison.
+//Parameters:  - numStrategies: Strategies compared, baseline included, at most
+//                              MAX_COMPARED.
+//             - numSeats:      Hands settled per Strategy each round.
+//------------------------------------------------------------------------------
+Comparison::Comparison(int numStrategies, int numSeats)
+{
+    this->numStrategies = max(1, min(numStrategies, MAX_COMPARED));
+    this->numSeats = max(1, numSeats);
+    this->rounds = 0;
+    for (int i = 0; i < MAX_COMPARED; i++)
+    {
+        this->sums[i] = 0;
+        this->squares[i] = 0;
+        this->diffSquares[i] = 0;
+    }
+} // end of Comparison
+
+//-----------------------------getNumStrategies---------------------------------
+//Description: Returns the number of strategies compared, baseline included.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+int Comparison::getNumStrategies() const
+{
+    return this->numStrategies;
+} // end of getNumStrategies
+
+//---------------------------------getRounds------------------------------------
+//Description: Returns the number of rounds every Strategy played.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+long long Comparison::getRounds() const
+{
+    return this->rounds;
+} // end of getRounds
+
+//----------------------------------getHands------------------------------------
+//Description: Returns the number of hands every Strategy settled.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+long long Comparison::getHands() const
+{
+    return this->rounds * this->numSeats;
+} // end of getHands
+
+//--------------------------------getHouseEdge----------------------------------
+//Description: Returns the Strategy's house edge per hand as a fraction of the
+//             initial bet.
+//Parameters:  - strategy: Index of the Strategy, 0 for the baseline.
+//------------------------------------------------------------------------------
+double Comparison::getHouseEdge(int strategy) const
+{
+    if (this->rounds == 0)
+    {
+        return 0;
+    }
+    return -(double) this->sums[strategy] / BET_UNITS / getHands();
+} // end of getHouseEdge
+
+//-------------------------------getDifference----------------------------------
+//Description: Returns how much more the Strategy wins per hand than the
+//             baseline, as a fraction of the initial bet.
+//Parameters:  - strategy: Index of the Strategy, 0 for the baseline.
+//------------------------------------------------------------------------------
+double Comparison::getDifference(int strategy) const
+{
+    return getHouseEdge(0) - getHouseEdge(strategy);
+} // end of getDifference
+
+//----------------------------getDifferenceError--------------------------------
+//Description: Returns the standard error of the paired difference.
+//Parameters:  - strategy: Index of the Strategy, 0 for the baseline.
+//------------------------------------------------------------------------------
+double Comparison::getDifferenceError(int strategy) const
+{
+    if (this->rounds == 0)
+    {
+        return 0;
+    }
+    long long sum = this->sums[strategy] - this->sums[0];
+    double perRound = variance(sum, this->diffSquares[strategy]) / this->rounds;
+    return sqrt(perRound) / BET_UNITS / this->numSeats;
+} // end of getDifferenceError
+
+//----------------------------getIndependentError-------------------------------
+//Description: Returns the standard error the difference would have had if
+//             each Strategy had played the same number of rounds from cards of
+//             its own.
+//Parameters:  - strategy: Index of the Strategy, 0 for the baseline.
+//------------------------------------------------------------------------------
+double Comparison::getIndependentError(int strategy) const
+{
+    if (this->rounds == 0)
+    {
+        return 0;
+    }
+    double perRound = (variance(this->sums[0], this->squares[0])
+        + variance(this->sums[strategy], this->squares[strategy])) / this->rounds;
+    return sqrt(perRound) / BET_UNITS / this->numSeats;
+} // end of getIndependentError
+
+//-------------------------------getCorrelation---------------------------------
+//Description: Returns the correlation between the Strategy's and the
+//             baseline's net result per round.
+//Parameters:  - strategy: Index of the Strategy, 0 for the baseline.
+//------------------------------------------------------------------------------
+double Comparison::getCorrelation(int strategy) const
+{
+    double baseline = variance(this->sums[0], this->squares[0]);
+    double other = variance(this->sums[strategy], this->squares[strategy]);
+    if (baseline <= 0 || other <= 0)
+    {
+        return 0;
+    }
+    double difference = variance(this->sums[strategy] - this->sums[0], this->diffSquares[strategy]);
+    return (baseline + other - difference) / (2 * sqrt(baseline * other));
+} // end of getCorrelation
+
+//----------------------------------variance------------------------------------
+//Description: Private function that returns the sample variance per round of
+//             a quantity from its sum and sum of squares.
+//Parameters:  - sum:        Sum over every round.
+//             - sumSquared: Sum of squares over every round.
+//------------------------------------------------------------------------------
+double Comparison::variance(long long sum, long long sumSquared) const
+{
+    if (this->rounds < 2)
+    {
+        return 0;
+    }
+    double mean = (double) sum / this->rounds;
+    return ((double) sumSquared / this->rounds - mean * mean) * this->rounds / (this->rounds - 1);
+} // end of variance
+
+//----------------------------------addRound------------------------------------
+//Description: Records a round every Strategy played from the same cards.
+//Parameters:  - nets: Each Strategy's net result over every seat in
+//                     BET_UNITS, baseline first.
+//------------------------------------------------------------------------------
+void Comparison::addRound(const int nets[])
+{
+    this->rounds++;
+    for (int i = 0; i < this->numStrategies; i++)
+    {
+        long long difference = nets[i] - nets[0];
+        this->sums[i] += nets[i];
+        this->squares[i] += (long long) nets[i] * nets[i];
+        this->diffSquares[i] += difference * difference;
+    }
+} // end of addRound
+
+//------------------------------------merge-------------------------------------
+//Description: Adds another Comparison of the same strategies into this one.
+//Parameters:  - other: The Comparison being merged in.
+//------------------------------------------------------------------------------
+void Comparison::merge(const Comparison &other)
+{
+    this->rounds += other.rounds;
+    for (int i = 0; i < this->numStrategies; i++)
+    {
+        this->sums[i] += other.sums[i];
+        this->squares[i] += other.squares[i];
+        this->diffSquares[i] += other.diffSquares[i];
+    }
+} // end of merge
@@ -0,0 +1,52 @@
+//-------------------------------Comparison.h-----------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the header file for the Comparison class used by the
+//             headless simulator. It accumulates rounds that every compared
+//             Strategy played from the same cards: the sum and sum of squares
+//             of each Strategy's net result per round, and the sum of squares
+//             of each Strategy's difference from the first (the baseline).
+//             Because both sides of a difference saw the same cards, most of
+//             the luck cancels and the difference has far less variance than
+//             two independent runs would. Net results are kept in BET_UNITS as
+//             in Results. It exposes functions to read each Strategy's house
+//             edge, the paired difference and its standard error, and the
+//             error two independent runs of the same size would have had.
+//------------------------------------------------------------------------------
+#ifndef COMPARISON_H
+#define COMPARISON_H
+#include <cmath>
+#include <algorithm>
+#include "Results.h"
+using namespace std;
+
+static const int MAX_COMPARED = 8;  //Most strategies one Comparison holds, baseline included
+
+class Comparison
+{
+    private:
+        int numStrategies;                      //Strategies compared, baseline first
+        int numSeats;                           //Hands settled per Strategy each round
+        long long rounds;                       //Rounds every Strategy played
+        long long sums[MAX_COMPARED];           //Sum of each Strategy's net per round
+        long long squares[MAX_COMPARED];        //Sum of each Strategy's squared net per round
+        long long diffSquares[MAX_COMPARED];    //Sum of each squared difference from the baseline
+        double variance(long long sum, long long sumSquared) const;
+
+    public:
+        //Constructors
+        Comparison(int numStrategies, int numSeats);
+        //Getters
+        int getNumStrategies() const;
+        long long getRounds() const;
+        long long getHands() const;
+        double getHouseEdge(int strategy) const;
+        double getDifference(int strategy) const;
+        double getDifferenceError(int strategy) const;
+        double getIndependentError(int strategy) const;
+        double getCorrelation(int strategy) const;
+        //Setters
+        void addRound(const int nets[]);
+        void merge(const Comparison &other);
+};
+#endif
@@ -0,0 +1,126 @@
+//-----------------------------------Hand.cpp-----------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the implementation file for the Hand class used by the
+//             headless simulator. Instead of a vector of Card pointers it keeps
+//             only the hard total, whether an Ace is held, and the number of
+//             cards, which is all the rules in Game need to score a hand. Ranks
+//             are 1 (Ace) through 10 (Ten and face cards). The class is used
+//             within Simulation and by Strategy objects when deciding an action.
+//------------------------------------------------------------------------------
+#include "Hand.h"
+
+//------------------------------------Hand--------------------------------------
+//Description: Default (empty) constructor for a Hand.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+Hand::Hand()
+{
+    clear();
+} // end of Hand
+
+//---------------------------------getPoints------------------------------------
+//Description: Returns the point total of the hand, counting one Ace as 11 when
+//             that doesn't BUST the hand -- the same result Game::bustCheck
+//             reaches by swapping Ace values from 11 to 1.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+int Hand::getPoints() const
+{
+    return isSoft() ? this->hardTotal + SOFT_BONUS : this->hardTotal;
+} // end of getPoints
+
+//-------------------------------getHardTotal-----------------------------------
+//Description: Returns the total with every Ace counted as 1.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+int Hand::getHardTotal() const
+{
+    return this->hardTotal;
+} // end of getHardTotal
+
+//--------------------------------getNumCards-----------------------------------
+//Description: Returns the number of cards in the hand.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+int Hand::getNumCards() const
+{
+    return this->numCards;
+} // end of getNumCards
+
+//--------------------------------getFirstRank----------------------------------
+//Description: Returns the rank of the first card dealt, the dealer's upcard.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+int Hand::getFirstRank() const
+{
+    return this->firstRank;
+} // end of getFirstRank
+
+//-----------------------------------isSoft-------------------------------------
+//Description: Returns true if an Ace in the hand is currently counted as 11.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+bool Hand::isSoft() const
+{
+    return this->hasAce && this->hardTotal + SOFT_BONUS <= BLACKJACK;
+} // end of isSoft
+
+//-----------------------------------isBust-------------------------------------
+//Description: Returns true if the hand is over 21.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+bool Hand::isBust() const
+{
+    return this->hardTotal > BLACKJACK;
+} // end of isBust
+
+//----------------------------------isNatural-----------------------------------
+//Description: Returns true if the hand is 21 on its first two cards.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+bool Hand::isNatural() const
+{
+    return this->numCards == 2 && getPoints() == BLACKJACK;
+} // end of isNatural
+
+//-----------------------------------isPair-------------------------------------
+//Description: Returns true if the hand is two cards of the same rank.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+bool Hand::isPair() const
+{
+    return this->numCards == 2 && this->pair;
+} // end of isPair
+
+//----------------------------------addCard-------------------------------------
+//Description: Adds a card of the given rank to the hand.
+//Parameters:  - rank: Rank of the card, 1 (Ace) through 10.
+//------------------------------------------------------------------------------
+void Hand::addCard(int rank)
+{
+    if (this->numCards == 0)
+    {
+        this->firstRank = rank;
+    }
+    else if (this->numCards == 1)
+    {
+        this->pair = rank == this->firstRank;
+    }
+    this->hardTotal += rank;
+    this->hasAce = this->hasAce || rank == ACE;
+    this->numCards++;
+} // end of addCard
+
+//-----------------------------------clear--------------------------------------
+//Description: Empties the hand for the next round.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+void Hand::clear()
+{
+    this->hardTotal = 0;
+    this->numCards = 0;
+    this->hasAce = false;
+    this->firstRank = 0;
+    this->pair = false;
+} // end of clear
@@ -0,0 +1,40 @@
+//-----------------------------------Hand.h-------------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the header file for the Hand class used by the headless
+//             simulator. Instead of a vector of Card pointers it keeps only the
+//             hard total, whether an Ace is held, and the number of cards, which
+//             is all the rules in Game need to score a hand. Ranks are 1 (Ace)
+//             through 10 (Ten and face cards). The class is used within
+//             Simulation and by Strategy objects when deciding an action.
+//------------------------------------------------------------------------------
+#ifndef HAND_H
+#define HAND_H
+#include "Rules.h"
+
+class Hand
+{
+    private:
+        int hardTotal;      //Sum of the ranks with every Ace counted as 1
+        int numCards;       //Number of cards in the hand
+        bool hasAce;        //Whether or not an Ace is in the hand
+        int firstRank;      //Rank of the first card, used to spot pairs
+        bool pair;          //Whether or not the first two cards share a rank
+
+    public:
+        //Constructors
+        Hand();
+        //Getters
+        int getPoints() const;
+        int getHardTotal() const;
+        int getNumCards() const;
+        int getFirstRank() const;
+        bool isSoft() const;
+        bool isBust() const;
+        bool isNatural() const;
+        bool isPair() const;
+        //Setters
+        void addCard(int rank);
+        void clear();
+};
+#endif
@@ -0,0 +1,249 @@
+//---------------------------------Results.cpp----------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the implementation file for the Results class used by the
+//             headless simulator. It accumulates the outcome of every simulated
+//             hand: the number of rounds and hands, wins, losses, pushes, BUSTs,
+//             double downs and surrenders, and the running sum and sum of
+//             squares of the net result. Net results are kept in tenths of the
+//             initial bet so a surrender (losing half the bet, see
+//             Game::settleBets) and a natural paid 3:2 or 6:5 stay exact
+//             integers. It exposes functions to read the house edge and
+//             variance per hand, to merge Results together, and to write and
+//             read them back in binary for checkpoints.
+//------------------------------------------------------------------------------
+#include "Results.h"
+
+//----------------------------------Results-------------------------------------
+//Description: Default (empty) constructor for Results.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+Results::Results()
+{
+    this->rounds = 0;
+    this->hands = 0;
+    this->wins = 0;
+    this->losses = 0;
+    this->pushes = 0;
+    this->busts = 0;
+    this->doubles = 0;
+    this->surrenders = 0;
+    this->net = 0;
+    this->netSquared = 0;
+} // end of Results
+
+//----------------------------------getRounds-----------------------------------
+//Description: Returns the number of rounds played.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+long long Results::getRounds() const
+{
+    return this->rounds;
+} // end of getRounds
+
+//-----------------------------------getHands-----------------------------------
+//Description: Returns the number of hands settled.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+long long Results::getHands() const
+{
+    return this->hands;
+} // end of getHands
+
+//-----------------------------------getWins------------------------------------
+//Description: Returns the number of hands that paid the Player.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+long long Results::getWins() const
+{
+    return this->wins;
+} // end of getWins
+
+//----------------------------------getLosses-----------------------------------
+//Description: Returns the number of hands the Player lost.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+long long Results::getLosses() const
+{
+    return this->losses;
+} // end of getLosses
+
+//----------------------------------getPushes-----------------------------------
+//Description: Returns the number of hands that tied the dealer.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+long long Results::getPushes() const
+{
+    return this->pushes;
+} // end of getPushes
+
+//-----------------------------------getBusts-----------------------------------
+//Description: Returns the number of hands that went over 21.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+long long Results::getBusts() const
+{
+    return this->busts;
+} // end of getBusts
+
+//----------------------------------getDoubles----------------------------------
+//Description: Returns the number of hands that doubled down.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+long long Results::getDoubles() const
+{
+    return this->doubles;
+} // end of getDoubles
+
+//--------------------------------getSurrenders---------------------------------
+//Description: Returns the number of hands that surrendered.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+long long Results::getSurrenders() const
+{
+    return this->surrenders;
+} // end of getSurrenders
+
+//----------------------------------getMean-------------------------------------
+//Description: Returns the Player's mean net result per hand in initial bets.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+double Results::getMean() const
+{
+    if (this->hands == 0)
+    {
+        return 0;
+    }
+    return (double) this->net / BET_UNITS / this->hands;
+} // end of getMean
+
+//--------------------------------getHouseEdge----------------------------------
+//Description: Returns the house edge, the dealer's mean win per hand as a
+//             fraction of the initial bet.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+double Results::getHouseEdge() const
+{
+    return -getMean();
+} // end of getHouseEdge
+
+//--------------------------------getVariance-----------------------------------
+//Description: Returns the variance of the net result per hand in initial bets
+//             squared.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+double Results::getVariance() const
+{
+    if (this->hands < 2)
+    {
+        return 0;
+    }
+    double mean = getMean();
+    double meanSquared = (double) this->netSquared / (BET_UNITS * BET_UNITS) / this->hands;
+    return (meanSquared - mean * mean) * this->hands / (this->hands - 1);
+} // end of getVariance
+
+//----------------------------getStandardDeviation------------------------------
+//Description: Returns the standard deviation of the net result per hand.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+double Results::getStandardDeviation() const
+{
+    return sqrt(getVariance());
+} // end of getStandardDeviation
+
+//-----------------------------getStandardError---------------------------------
+//Description: Returns the standard error of the house edge.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+double Results::getStandardError() const
+{
+    if (this->hands == 0)
+    {
+        return 0;
+    }
+    return sqrt(getVariance() / this->hands);
+} // end of getStandardError
+
+//----------------------------------addRound------------------------------------
+//Description: Counts a round played.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+void Results::addRound()
+{
+    this->rounds++;
+} // end of addRound
+
+//-----------------------------------addHand------------------------------------
+//Description: Records the outcome of a settled hand.
+//Parameters:  - units:       Net result for the Player in BET_UNITS.
+//             - bust:        Whether or not the hand went over 21.
+//             - doubled:     Whether or not the hand doubled down.
+//             - surrendered: Whether or not the hand surrendered.
+//------------------------------------------------------------------------------
+void Results::addHand(int units, bool bust, bool doubled, bool surrendered)
+{
+    this->hands++;
+    this->wins += units > 0;
+    this->losses += units < 0;
+    this->pushes += units == 0;
+    this->busts += bust;
+    this->doubles += doubled;
+    this->surrenders += surrendered;
+    this->net += units;
+    this->netSquared += units * units;
+} // end of addHand
+
+//------------------------------------merge-------------------------------------
+//Description: Adds another set of Results into these Results.
+//Parameters:  - other: The Results being merged in.
+//------------------------------------------------------------------------------
+void Results::merge(const Results &other)
+{
+    this->rounds += other.rounds;
+    this->hands += other.hands;
+    this->wins += other.wins;
+    this->losses += other.losses;
+    this->pushes += other.pushes;
+    this->busts += other.busts;
+    this->doubles += other.doubles;
+    this->surrenders += other.surrenders;
+    this->net += other.net;
+    this->netSquared += other.netSquared;
+} // end of merge
+
+//------------------------------------write-------------------------------------
+//Description: Writes every count and sum as raw 64 bit integers.
+//Parameters:  - out: Binary stream to write to.
+//------------------------------------------------------------------------------
+void Results::write(ostream &out) const
+{
+    const long long fields[] = { this->rounds, this->hands, this->wins, this->losses, this->pushes,
+        this->busts, this->doubles, this->surrenders, this->net, this->netSquared };
+    out.write((const char*) fields, sizeof(fields));
+} // end of write
+
+//------------------------------------read--------------------------------------
+//Description: Replaces these Results with ones written by write. Returns false
+//             and leaves them unchanged if the stream ends early.
+//Parameters:  - in: Binary stream to read from.
+//------------------------------------------------------------------------------
+bool Results::read(istream &in)
+{
+    long long fields[10];
+    if (!in.read((char*) fields, sizeof(fields)))
+    {
+        return false;
+    }
+    this->rounds = fields[0];
+    this->hands = fields[1];
+    this->wins = fields[2];
+    this->losses = fields[3];
+    this->pushes = fields[4];
+    this->busts = fields[5];
+    this->doubles = fields[6];
+    this->surrenders = fields[7];
+    this->net = fields[8];
+    this->netSquared = fields[9];
+    return true;
+} // end of read
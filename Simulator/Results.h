@@ -0,0 +1,62 @@
+//---------------------------------Results.h------------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the header file for the Results class used by the
+//             headless simulator. It accumulates the outcome of every simulated
+//             hand: the number of rounds and hands, wins, losses, pushes, BUSTs,
+//             double downs and surrenders, and the running sum and sum of
+//             squares of the net result. Net results are kept in tenths of the
+//             initial bet so a surrender (losing half the bet, see
+//             Game::settleBets) and a natural paid 3:2 or 6:5 stay exact
+//             integers. It exposes functions to read the house edge and
+//             variance per hand, to merge Results together, and to write and
+//             read them back in binary for checkpoints.
+//------------------------------------------------------------------------------
+#ifndef RESULTS_H
+#define RESULTS_H
+#include <cmath>
+#include <istream>
+#include <ostream>
+using namespace std;
+
+static const int BET_UNITS = 10;    //Units in one initial bet
+
+class Results
+{
+    private:
+        long long rounds;       //Rounds played
+        long long hands;        //Hands settled
+        long long wins;         //Hands that paid the Player
+        long long losses;       //Hands the Player lost, including surrenders
+        long long pushes;       //Hands that tied the dealer
+        long long busts;        //Hands that went over 21
+        long long doubles;      //Hands that doubled down
+        long long surrenders;   //Hands that surrendered
+        long long net;          //Sum of net results in BET_UNITS
+        long long netSquared;   //Sum of squared net results in BET_UNITS
+
+    public:
+        //Constructors
+        Results();
+        //Getters
+        long long getRounds() const;
+        long long getHands() const;
+        long long getWins() const;
+        long long getLosses() const;
+        long long getPushes() const;
+        long long getBusts() const;
+        long long getDoubles() const;
+        long long getSurrenders() const;
+        double getMean() const;
+        double getHouseEdge() const;
+        double getVariance() const;
+        double getStandardDeviation() const;
+        double getStandardError() const;
+        void write(ostream &out) const;
+        //Setters
+        void addRound();
+        void addHand(int units, bool bust, bool doubled, bool surrendered);
+        void merge(const Results &other);
+        bool read(istream &in);
+};
+#endif
@@ -0,0 +1,273 @@
+//-----------------------------RunController.cpp--------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the implementation file for the RunController class. It
+//             drives a Runner through a long simulation in batches of shoes,
+//             merging each batch into a running Results, reporting progress at
+//             most once per interval, and stopping as soon as the 95% margin on
+//             the house edge is within the target precision. The running
+//             Results keep exact integer sums of the net result and its square,
+//             so the streaming mean and variance are read without rounding
+//             error and batches merge to the same totals on any thread count.
+//             A checkpoint holds the RunSettings, the shoes and batch size
+//             played, and those Results, so resuming from it plays the rest of
+//             the run exactly as if it had never stopped.
+//------------------------------------------------------------------------------
+#include "RunController.h"
+#include <iomanip>
+#include <fstream>
+#include <cstdio>
+#include <cstring>
+
+//-------------------------------RunController----------------------------------
+//Description: Constructor for a RunController.
+//Parameters:  - runner:    Runner playing every batch.
+//             - precision: Target 95% margin on the house edge as a fraction
+//                          of the initial bet, 0 to play every shoe.
+//             - maxShoes:  Most shoes to play.
+//             - progress:  Stream progress is reported to, null for none.
+//------------------------------------------------------------------------------
+RunController::RunController(Runner* runner, double precision, long long maxShoes, long long rounds, ostream* progress)
+{
+    this->runner = runner;
+    this->precision = max(0.0, precision);
+    this->maxShoes = maxShoes;
+    this->rounds = max(0LL, rounds);
+    this->shoes = 0;
+    this->progress = progress;
+    this->lastReport = 0;
+    this->batch = FIRST_BATCH;
+    this->resumedHands = 0;
+    this->lastCheckpoint = 0;
+} // end of RunController
+
+//----------------------------------getShoes------------------------------------
+//Description: Returns the number of shoes played so far.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+long long RunController::getShoes() const
+{
+    return this->shoes;
+} // end of getShoes
+
+//---------------------------------getMargin------------------------------------
+//Description: Returns the current 95% margin on the house edge as a fraction
+//             of the initial bet.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+double RunController::getMargin() const
+{
+    return Z_95 * this->results.getStandardError();
+} // end of getMargin
+
+//------------------------------reachedPrecision--------------------------------
+//Description: Returns true if a target precision was set and the run stopped
+//             because it was reached.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+bool RunController::reachedPrecision() const
+{
+    return this->precision > 0 && precise();
+} // end of reachedPrecision
+
+//------------------------------getResumedHands---------------------------------
+//Description: Returns the number of hands played before the run was resumed,
+//             0 for a fresh run.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+long long RunController::getResumedHands() const
+{
+    return this->resumedHands;
+} // end of getResumedHands
+
+//--------------------------------readSettings----------------------------------
+//Description: Reads the RunSettings at the start of a checkpoint. Returns false
+//             if the file can't be read or isn't a checkpoint.
+//Parameters:  - path:     Checkpoint file.
+//             - settings: Receives the settings.
+//------------------------------------------------------------------------------
+bool RunController::readSettings(const string &path, RunSettings* settings)
+{
+    ifstream in(path, ios::binary);
+    char magic[sizeof(CHECKPOINT_MAGIC)];
+    int version;
+    if (!in.read(magic, sizeof(magic)) || memcmp(magic, CHECKPOINT_MAGIC, sizeof(magic)) != 0
+        || !in.read((char*) &version, sizeof(version)) || version != CHECKPOINT_VERSION
+        || !in.read((char*) settings, sizeof(RunSettings)))
+    {
+        return false;
+    }
+    settings->strategy[SETTING_NAME - 1] = '\0';
+    settings->rules[SETTING_NAME - 1] = '\0';
+    return true;
+} // end of readSettings
+
+//-------------------------------shoesForRounds---------------------------------
+//Description: Returns how many shoes to play next toward a number of rounds,
+//             judged from the rounds the shoes played so far held. A batch is
+//             sized for most of the rounds still wanted, so the run stops
+//             within about a shoe of them without every shoe played alone.
+//Parameters:  - rounds: Rounds to play.
+//             - shoes:  Shoes played so far.
+//             - played: Rounds played so far.
+//------------------------------------------------------------------------------
+long long RunController::shoesForRounds(long long rounds, long long shoes, long long played)
+{
+    if (shoes == 0 || played == 0)
+    {
+        return PROBE_BATCH;
+    }
+    double perShoe = (double) played / shoes;
+    return max(1LL, (long long) ((rounds - played) * ROUNDS_SHARE / perShoe));
+} // end of shoesForRounds
+
+//-------------------------------setCheckpoint----------------------------------
+//Description: Writes a checkpoint of the run to the given file after a batch
+//             at most once per interval, and once the run is done.
+//Parameters:  - path:     Checkpoint file.
+//             - settings: Settings the run was started with.
+//------------------------------------------------------------------------------
+void RunController::setCheckpoint(const string &path, const RunSettings &settings)
+{
+    this->checkpoint = path;
+    this->settings = settings;
+} // end of setCheckpoint
+
+//-----------------------------------resume-------------------------------------
+//Description: Picks the run up from a checkpoint: the shoes and batch size
+//             already played and their Results. The Runner must have been
+//             built from the checkpoint's RunSettings. Returns false and
+//             leaves the run fresh if the checkpoint can't be read.
+//Parameters:  - path: Checkpoint file.
+//------------------------------------------------------------------------------
+bool RunController::resume(const string &path)
+{
+    RunSettings settings;
+    if (!readSettings(path, &settings))
+    {
+        return false;
+    }
+    ifstream in(path, ios::binary);
+    in.seekg(sizeof(CHECKPOINT_MAGIC) + sizeof(CHECKPOINT_VERSION) + sizeof(RunSettings));
+    long long shoes, batch;
+    Results results;
+    if (!in.read((char*) &shoes, sizeof(shoes)) || !in.read((char*) &batch, sizeof(batch))
+        || !results.read(in))
+    {
+        return false;
+    }
+    this->shoes = shoes;
+    this->batch = batch;
+    this->results = results;
+    this->resumedHands = results.getHands();
+    return true;
+} // end of resume
+
+//------------------------------------run---------------------------------------
+//Description: Plays batches of shoes until the target precision is reached,
+//             the rounds asked for or the most shoes have been played, and
+//             returns the Results of every shoe played.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+Results RunController::run()
+{
+    this->started = chrono::steady_clock::now();
+    while (this->shoes < this->maxShoes && !(this->precision > 0 && precise()) && !playedRounds())
+    {
+        long long size = min(this->batch, this->maxShoes - this->shoes);
+        if (this->rounds > 0)
+        {
+            size = min(size, shoesForRounds(this->rounds, this->shoes, this->results.getRounds()));
+        }
+        this->results.merge(this->runner->run(this->shoes, size));
+        this->shoes += size;
+        this->batch = min(this->batch * 2, MAX_BATCH);
+
+        chrono::duration<double> elapsed = chrono::steady_clock::now() - this->started;
+        if (elapsed.count() - this->lastReport >= REPORT_INTERVAL)
+        {
+            report(elapsed.count());
+        }
+        if (elapsed.count() - this->lastCheckpoint >= CHECKPOINT_INTERVAL)
+        {
+            writeCheckpoint(elapsed.count());
+        }
+    }
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - this->started;
+    writeCheckpoint(elapsed.count());
+    return this->results;
+} // end of run
+
+//----------------------------------precise-------------------------------------
+//Description: Private function that returns true once the margin on the house
+//             edge is within the target precision.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+bool RunController::precise() const
+{
+    return this->results.getHands() > 1 && getMargin() <= this->precision;
+} // end of precise
+
+//--------------------------------playedRounds----------------------------------
+//Description: Private function that returns true once the rounds asked for
+//             have been played.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+bool RunController::playedRounds() const
+{
+    return this->rounds > 0 && this->results.getRounds() >= this->rounds;
+} // end of playedRounds
+
+//-----------------------------------report-------------------------------------
+//Description: Private function that writes a line of progress: shoes and
+//             hands played, the house edge and its 95% margin so far, and the
+//             throughput.
+//Parameters:  - seconds: Seconds since the run started.
+//------------------------------------------------------------------------------
+void RunController::report(double seconds)
+{
+    this->lastReport = seconds;
+    if (this->progress == nullptr)
+    {
+        return;
+    }
+    *this->progress << fixed << setprecision(4)
+        << "[" << setprecision(1) << seconds << "s] shoes " << this->shoes
+        << "  hands " << this->results.getHands()
+        << setprecision(4) << "  house edge " << showpos << this->results.getHouseEdge() * 100
+        << noshowpos << "% +/- " << getMargin() * 100 << "%"
+        << setprecision(2) << "  " << (this->results.getHands() - this->resumedHands) / seconds / 1e6
+        << " million hands/s"
+        << endl;
+} // end of report
+
+//------------------------------writeCheckpoint---------------------------------
+//Description: Private function that writes the RunSettings, the shoes and
+//             batch size played, and the merged Results to a temporary file and
+//             renames it over the checkpoint, so a run killed mid-write still
+//             has its last checkpoint. Returns false if it couldn't be written.
+//Parameters:  - seconds: Seconds since the run started.
+//------------------------------------------------------------------------------
+bool RunController::writeCheckpoint(double seconds)
+{
+    this->lastCheckpoint = seconds;
+    if (this->checkpoint.empty())
+    {
+        return false;
+    }
+    string temporary = this->checkpoint + ".tmp";
+    {
+        ofstream out(temporary, ios::binary | ios::trunc);
+        out.write(CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC));
+        out.write((const char*) &CHECKPOINT_VERSION, sizeof(CHECKPOINT_VERSION));
+        out.write((const char*) &this->settings, sizeof(RunSettings));
+        out.write((const char*) &this->shoes, sizeof(this->shoes));
+        out.write((const char*) &this->batch, sizeof(this->batch));
+        this->results.write(out);
+        if (!out.flush())
+        {
+            return false;
+        }
+    }
+    return rename(temporary.c_str(), this->checkpoint.c_str()) == 0;
+} // end of writeCheckpoint
@@ -0,0 +1,90 @@
+//------------------------------RunController.h---------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the header file for the RunController class. It drives
+//             a Runner through a long simulation in batches of shoes, merging
+//             each batch into a running Results, reporting progress (shoes,
+//             hands, house edge with its 95% margin, and throughput) at most
+//             once per interval, and stopping as soon as the margin on the
+//             house edge is within the target precision or enough rounds
+//             have been played, in whole shoes. Batches start small
+//             and double up to a cap, so a loose target stops early and a
+//             tight one keeps every thread busy. Batch sizes depend only on
+//             how many shoes have been played, never on timing, so where a run
+//             stops depends only on the seed and target, not the threads.
+//             Since shoe i is always shuffled from substream i of the seed,
+//             the shoes played so far stand in for every RNG position, and a
+//             checkpoint of the RunSettings, the shoes and batch size played,
+//             and the merged Results is enough to resume a run exactly where
+//             it left off. Checkpoints are written at most once per interval,
+//             to a temporary file renamed over the last one.
+//------------------------------------------------------------------------------
+#ifndef RUNCONTROLLER_H
+#define RUNCONTROLLER_H
+#include <ostream>
+#include <chrono>
+#include <string>
+#include "Runner.h"
+#include "Results.h"
+using namespace std;
+
+static const long long FIRST_BATCH = 1000;      //Shoes in the first batch
+static const long long MAX_BATCH = 32000;       //Most shoes in one batch
+static const long long PROBE_BATCH = 16;        //Shoes played to see how many rounds a shoe holds
+static const double ROUNDS_SHARE = 0.9;         //Share of the rounds still wanted a batch is sized for
+static const double Z_95 = 1.96;                //Standard errors in a 95% margin
+static const double REPORT_INTERVAL = 1.0;      //Least seconds between progress reports
+static const double CHECKPOINT_INTERVAL = 60.0; //Least seconds between checkpoints
+static const int SETTING_NAME = 16;             //Bytes kept of the Strategy's or rules' name
+static const char CHECKPOINT_MAGIC[4] = { 'B', 'J', 'C', 'K' };
+static const int CHECKPOINT_VERSION = 3;
+
+//Everything that decides which shoes a run plays and how they are played
+struct RunSettings
+{
+    unsigned long long seed;        //Seed every shoe's substream is split from
+    int numSeats;                   //Number of occupied seats
+    char strategy[SETTING_NAME];    //Name of the Strategy every seat plays
+    char rules[SETTING_NAME];       //Name of the rules the table is played by
+    double precision;               //Target 95% margin on the house edge, 0 for none
+    long long maxShoes;             //Most shoes to play
+    long long rounds;               //Least rounds to play in whole shoes, 0 for none
+};
+
+class RunController
+{
+    private:
+        Runner* runner;             //Runner playing every batch
+        double precision;           //Target 95% margin on the house edge, 0 to play every shoe
+        long long maxShoes;         //Most shoes to play
+        long long rounds;           //Least rounds to play in whole shoes, 0 to play every shoe
+        long long shoes;            //Shoes played so far
+        Results results;            //Results of every shoe played so far
+        ostream* progress;          //Stream progress is reported to, null for none
+        chrono::steady_clock::time_point started;   //When the run started
+        double lastReport;          //Seconds into the run of the last progress report
+        long long batch;            //Shoes in the next batch
+        long long resumedHands;     //Hands already played when the run was resumed
+        string checkpoint;          //File checkpoints are written to, empty for none
+        RunSettings settings;       //Settings written with every checkpoint
+        double lastCheckpoint;      //Seconds into the run of the last checkpoint
+        bool precise() const;
+        bool playedRounds() const;
+        void report(double seconds);
+        bool writeCheckpoint(double seconds);
+
+    public:
+        RunController(Runner* runner, double precision, long long maxShoes, long long rounds, ostream* progress);
+        //Getters
+        long long getShoes() const;
+        double getMargin() const;
+        bool reachedPrecision() const;
+        long long getResumedHands() const;
+        static bool readSettings(const string &path, RunSettings* settings);
+        static long long shoesForRounds(long long rounds, long long shoes, long long played);
+        //Setters
+        void setCheckpoint(const string &path, const RunSettings &settings);
+        bool resume(const string &path);
+        Results run();
+};
+#endif
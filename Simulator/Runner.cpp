@@ -0,0 +1,287 @@
+//---------------------------------Runner.cpp-----------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the implementation file for the Runner class. It spreads
+//             a simulation over every core by splitting the work into shoes,
+//             shoe i played by Simulation::playShoe from substream i of the
+//             Runner's seed. Every
+//             worker thread owns a range of shoe indexes packed in one atomic
+//             word; it takes shoes from the front of its own range and, once
+//             empty, steals the back half of another worker's range. Each
+//             worker accumulates into its own Results in a slot padded to a
+//             cache line, and the slots are merged once every thread is done.
+//             Bankroll sessions and paired shoes are spread the same way.
+//------------------------------------------------------------------------------
+#include "Runner.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <new>
+
+//Pack and unpack a worker's range [next, end) in a single atomic word
+static unsigned long long packRange(unsigned long long next, unsigned long long end)
+{
+    return (next << 32) | end;
+}
+static unsigned long long rangeNext(unsigned long long range)
+{
+    return range >> 32;
+}
+static unsigned long long rangeEnd(unsigned long long range)
+{
+    return range & 0xFFFFFFFFULL;
+}
+
+//-----------------------------------Runner-------------------------------------
+//Description: Constructor for a Runner. Workers are allocated on cache line
+//             boundaries so no two threads write to the same line.
+//Parameters:  - engine:     Creates each worker's Simulation for the rules played.
+//             - strategy:   Strategy every seat plays.
+//             - numSeats:   Number of occupied seats.
+//             - seed:       Seed every shoe's substream is split from.
+//             - numThreads: Number of worker threads.
+//------------------------------------------------------------------------------
+Runner::Runner(EngineFactory engine, const Strategy* strategy, int numSeats, unsigned long long seed, int numThreads)
+    : master(seed)
+{
+    this->engine = engine;
+    this->strategy = strategy;
+    this->numSeats = numSeats;
+    this->numThreads = max(1, numThreads);
+    this->betting = nullptr;
+    this->rivals = nullptr;
+    this->numRivals = 0;
+    void* memory = nullptr;
+    if (posix_memalign(&memory, CACHE_LINE, sizeof(Worker) * this->numThreads) != 0)
+    {
+        throw bad_alloc();
+    }
+    this->workers = (Worker*) memory;
+    for (int i = 0; i < this->numThreads; i++)
+    {
+        new (&this->workers[i]) Worker();
+        this->workers[i].sessions = nullptr;
+        this->workers[i].comparison = nullptr;
+        this->workers[i].runner = this;
+        this->workers[i].index = i;
+    }
+} // end of Runner
+
+//----------------------------------~Runner-------------------------------------
+//Description: Destructor for a Runner.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+Runner::~Runner()
+{
+    for (int i = 0; i < this->numThreads; i++)
+    {
+        delete this->workers[i].sessions;
+        delete this->workers[i].comparison;
+        this->workers[i].~Worker();
+    }
+    free(this->workers);
+} // end of ~Runner
+
+//-------------------------------getNumThreads----------------------------------
+//Description: Returns the number of worker threads.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+int Runner::getNumThreads() const
+{
+    return this->numThreads;
+} // end of getNumThreads
+
+//------------------------------------run---------------------------------------
+//Description: Plays the given number of shoes over every worker thread and
+//             returns the merged Results.
+//Parameters:  - shoes: Number of shoes to play.
+//------------------------------------------------------------------------------
+Results Runner::run(long long shoes)
+{
+    return run(0, shoes);
+} // end of run
+
+//------------------------------------run---------------------------------------
+//Description: Plays the shoes from index first on over every worker thread and
+//             returns their merged Results, so a long run can be played in
+//             batches that add up to the same Results as one run.
+//Parameters:  - first: Index of the first shoe to play.
+//             - shoes: Number of shoes to play.
+//------------------------------------------------------------------------------
+Results Runner::run(long long first, long long shoes)
+{
+    this->betting = nullptr;
+    this->rivals = nullptr;
+    for (int i = 0; i < this->numThreads; i++)
+    {
+        this->workers[i].results = Results();
+    }
+    start(first, shoes);
+    Results results;
+    for (int i = 0; i < this->numThreads; i++)
+    {
+        pthread_join(this->workers[i].thread, nullptr);
+        results.merge(this->workers[i].results);
+    }
+    return results;
+} // end of run
+
+//---------------------------------runPaired------------------------------------
+//Description: Plays paired shoes from index first on over every worker thread,
+//             every round dealt to the Runner's Strategy and to each rival from
+//             the same cards, and returns the merged Comparison.
+//Parameters:  - first:     Index of the first shoe to play.
+//             - shoes:     Number of shoes to play.
+//             - rivals:    Strategies compared against the Runner's Strategy.
+//             - numRivals: Number of rivals, below MAX_COMPARED.
+//------------------------------------------------------------------------------
+Comparison Runner::runPaired(long long first, long long shoes, const Strategy* const rivals[], int numRivals)
+{
+    this->betting = nullptr;
+    this->rivals = rivals;
+    this->numRivals = min(numRivals, MAX_COMPARED - 1);
+    for (int i = 0; i < this->numThreads; i++)
+    {
+        delete this->workers[i].comparison;
+        this->workers[i].comparison = new Comparison(this->numRivals + 1, this->numSeats);
+    }
+    start(first, shoes);
+    Comparison merged(this->numRivals + 1, this->numSeats);
+    for (int i = 0; i < this->numThreads; i++)
+    {
+        pthread_join(this->workers[i].thread, nullptr);
+        merged.merge(*this->workers[i].comparison);
+    }
+    return merged;
+} // end of runPaired
+
+//--------------------------------runSessions-----------------------------------
+//Description: Plays the given number of bankroll sessions over every worker
+//             thread and returns the merged Sessions.
+//Parameters:  - sessions:    Number of sessions to play.
+//             - betting:     BettingSystem sizing every bet.
+//             - limits:      Starting bankroll, round limit and goal.
+//             - maxBankroll: Highest bankroll a session can end on.
+//------------------------------------------------------------------------------
+Sessions Runner::runSessions(long long sessions, const BettingSystem* betting, const SessionLimits &limits, int maxBankroll)
+{
+    this->betting = betting;
+    this->limits = limits;
+    this->rivals = nullptr;
+    for (int i = 0; i < this->numThreads; i++)
+    {
+        delete this->workers[i].sessions;
+        this->workers[i].sessions = new Sessions(maxBankroll, limits.rounds);
+    }
+    start(0, sessions);
+    Sessions merged(maxBankroll, limits.rounds);
+    for (int i = 0; i < this->numThreads; i++)
+    {
+        pthread_join(this->workers[i].thread, nullptr);
+        merged.merge(*this->workers[i].sessions);
+    }
+    return merged;
+} // end of runSessions
+
+//-----------------------------------start--------------------------------------
+//Description: Private function that gives every worker an even share of the
+//             units of work (shoes or sessions) and starts its thread.
+//Parameters:  - first: Index of the first unit to play.
+//             - units: Number of shoes or sessions to play.
+//------------------------------------------------------------------------------
+void Runner::start(long long first, long long units)
+{
+    for (int i = 0; i < this->numThreads; i++)
+    {
+        unsigned long long begin = first + units * i / this->numThreads;
+        unsigned long long end = first + units * (i + 1) / this->numThreads;
+        this->workers[i].range.store(packRange(begin, end));
+    }
+    for (int i = 0; i < this->numThreads; i++)
+    {
+        if (pthread_create(&this->workers[i].thread, nullptr, work, &this->workers[i]) != 0)
+        {
+            perror("pthread_create() failure\n");
+        }
+    }
+} // end of start
+
+//------------------------------------work--------------------------------------
+//Description: Private function run by each worker thread. Plays shoes,
+//             sessions in bankroll mode, or paired shoes in paired mode, from
+//             its own range, then from stolen ranges, until no work is left.
+//Parameters:  - arg: The Worker.
+//------------------------------------------------------------------------------
+void* Runner::work(void* arg)
+{
+    Worker* worker = (Worker*) arg;
+    Runner* runner = worker->runner;
+    Engine* simulation = runner->engine(runner->strategy, runner->numSeats, runner->master.getSeed());
+    long long shoe;
+    while (runner->takeShoe(worker, &shoe) || runner->stealShoe(worker, &shoe))
+    {
+        if (runner->betting != nullptr)
+        {
+            simulation->playSession(runner->master.substream(shoe), runner->betting, runner->limits, *worker->sessions);
+        }
+        else if (runner->rivals != nullptr)
+        {
+            simulation->playPairedShoe(runner->master.substream(shoe), runner->rivals, runner->numRivals, *worker->comparison);
+        }
+        else
+        {
+            simulation->playShoe(runner->master.substream(shoe));
+        }
+    }
+    worker->results = simulation->getResults();
+    delete simulation;
+    return nullptr;
+} // end of work
+
+//---------------------------------takeShoe-------------------------------------
+//Description: Private function that takes the next shoe from the front of the
+//             worker's own range. Returns false if the range is empty.
+//Parameters:  - worker: The Worker taking a shoe.
+//             - shoe:   Receives the index of the shoe.
+//------------------------------------------------------------------------------
+bool Runner::takeShoe(Worker* worker, long long* shoe)
+{
+    unsigned long long range = worker->range.load(memory_order_relaxed);
+    while (rangeNext(range) < rangeEnd(range))
+    {
+        if (worker->range.compare_exchange_weak(range, packRange(rangeNext(range) + 1, rangeEnd(range))))
+        {
+            *shoe = rangeNext(range);
+            return true;
+        }
+    }
+    return false;
+} // end of takeShoe
+
+//---------------------------------stealShoe------------------------------------
+//Description: Private function that steals the back half of another worker's
+//             range, keeps it as the worker's own range, and takes its first
+//             shoe. Returns false once every range is empty.
+//Parameters:  - worker: The Worker stealing.
+//             - shoe:   Receives the index of the shoe.
+//------------------------------------------------------------------------------
+bool Runner::stealShoe(Worker* worker, long long* shoe)
+{
+    for (int i = 1; i < this->numThreads; i++)
+    {
+        Worker* victim = &this->workers[(worker->index + i) % this->numThreads];
+        unsigned long long range = victim->range.load(memory_order_relaxed);
+        while (rangeNext(range) < rangeEnd(range))
+        {
+            unsigned long long next = rangeNext(range);
+            unsigned long long end = rangeEnd(range);
+            unsigned long long split = next + (end - next) / 2;
+            if (victim->range.compare_exchange_weak(range, packRange(next, split)))
+            {
+                worker->range.store(packRange(split + 1, end));
+                *shoe = split;
+                return true;
+            }
+        }
+    }
+    return false;
+} // end of stealShoe
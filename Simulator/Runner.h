@@ -0,0 +1,75 @@
+//----------------------------------Runner.h------------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the header file for the Runner class. It spreads a
+//             simulation over every core by splitting the work into shoes,
+//             shoe i played by Simulation::playShoe from substream i of the
+//             Runner's seed, on an Engine built for the rules being played.
+//             Every worker thread owns a range of shoe indexes packed in one atomic
+//             word; it takes shoes from the front of its own range and, once
+//             empty, steals the back half of another worker's range. Each
+//             worker accumulates into its own Results in a slot padded to a
+//             cache line, and the slots are merged once every thread is done.
+//             The total only depends on the seed and number of shoes, so a 1
+//             and 64 thread run are bit-identical. Bankroll sessions are spread
+//             the same way, session i played by Simulation::playSession from
+//             substream i, each worker streaming into its own Sessions, and
+//             so are paired shoes, each worker keeping its own Comparison.
+//------------------------------------------------------------------------------
+#ifndef RUNNER_H
+#define RUNNER_H
+#include <atomic>
+#include <pthread.h>
+#include "Simulation.h"
+#include "Strategy.h"
+#include "Results.h"
+#include "Betting.h"
+#include "Sessions.h"
+#include "Comparison.h"
+using namespace std;
+
+static const int CACHE_LINE = 64;   //Bytes in a cache line
+
+class Runner
+{
+    private:
+        //A worker's range of shoes and its Results, kept on its own cache lines
+        struct alignas(CACHE_LINE) Worker
+        {
+            atomic<unsigned long long> range;   //Next shoe in the high half, end in the low half
+            Results results;                    //Results of every shoe this worker played
+            Sessions* sessions;                 //Sessions this worker played, in bankroll mode
+            Comparison* comparison;             //Paired rounds this worker played, in paired mode
+            Runner* runner;                     //Runner the worker belongs to
+            int index;                          //Index of the worker
+            pthread_t thread;                   //Thread running the worker
+        };
+
+        EngineFactory engine;       //Creates each worker's Simulation for the rules played
+        const Strategy* strategy;   //Strategy every seat plays
+        int numSeats;               //Number of occupied seats
+        Random master;              //Generator every shoe's substream is split from
+        int numThreads;             //Number of worker threads
+        Worker* workers;            //Workers, aligned to cache lines
+        const BettingSystem* betting;   //Sizes every bet in bankroll mode, null otherwise
+        SessionLimits limits;       //Limits every session shares in bankroll mode
+        const Strategy* const* rivals;  //Strategies compared against strategy in paired mode, null otherwise
+        int numRivals;              //Number of rivals
+        void start(long long first, long long units);
+        static void* work(void* arg);
+        bool takeShoe(Worker* worker, long long* shoe);
+        bool stealShoe(Worker* worker, long long* shoe);
+
+    public:
+        Runner(EngineFactory engine, const Strategy* strategy, int numSeats, unsigned long long seed, int numThreads);
+        Runner(const Runner &runner) = delete;
+        ~Runner();
+        //Getters
+        int getNumThreads() const;
+        //Setters
+        Results run(long long shoes);
+        Results run(long long first, long long shoes);
+        Comparison runPaired(long long first, long long shoes, const Strategy* const rivals[], int numRivals);
+        Sessions runSessions(long long sessions, const BettingSystem* betting, const SessionLimits &limits, int maxBankroll);
+};
+#endif
@@ -0,0 +1,160 @@
+//-------------------------------Sessions.cpp-----------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the implementation file for the Sessions class used by
+//             the simulator's bankroll mode. It accumulates the outcome of every
+//             session into counters and fixed size histograms, so results are
+//             streamed rather than stored.
+//------------------------------------------------------------------------------
+#include "Sessions.h"
+
+//----------------------------------Sessions------------------------------------
+//Description: Constructor for empty Sessions with histograms covering every
+//             bankroll and length a session can end on.
+//Parameters:  - maxBankroll: Highest bankroll a session can end on.
+//             - maxRounds:   Most rounds a session can last.
+//------------------------------------------------------------------------------
+Sessions::Sessions(int maxBankroll, int maxRounds)
+    : bankrolls(maxBankroll + 1), lengths(maxRounds + 1)
+{
+    this->sessions = 0;
+    this->ruined = 0;
+    this->goals = 0;
+    this->rounds = 0;
+    this->bankrollSum = 0;
+} // end of Sessions
+
+//--------------------------------getSessions-----------------------------------
+//Description: Returns the number of sessions played.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+long long Sessions::getSessions() const
+{
+    return this->sessions;
+} // end of getSessions
+
+//---------------------------------getRounds------------------------------------
+//Description: Returns the number of rounds played in all sessions.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+long long Sessions::getRounds() const
+{
+    return this->rounds;
+} // end of getRounds
+
+//-------------------------------getRiskOfRuin----------------------------------
+//Description: Returns the fraction of sessions that ran out of money.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+double Sessions::getRiskOfRuin() const
+{
+    return this->sessions == 0 ? 0 : (double) this->ruined / this->sessions;
+} // end of getRiskOfRuin
+
+//--------------------------------getGoalRate-----------------------------------
+//Description: Returns the fraction of sessions that reached the goal.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+double Sessions::getGoalRate() const
+{
+    return this->sessions == 0 ? 0 : (double) this->goals / this->sessions;
+} // end of getGoalRate
+
+//------------------------------getMeanBankroll---------------------------------
+//Description: Returns the mean final bankroll in dollars.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+double Sessions::getMeanBankroll() const
+{
+    return this->sessions == 0 ? 0 : (double) this->bankrollSum / this->sessions;
+} // end of getMeanBankroll
+
+//-------------------------------getMeanLength----------------------------------
+//Description: Returns the mean session length in rounds.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+double Sessions::getMeanLength() const
+{
+    return this->sessions == 0 ? 0 : (double) this->rounds / this->sessions;
+} // end of getMeanLength
+
+//---------------------------getBankrollPercentile------------------------------
+//Description: Returns the final bankroll that the given fraction of sessions
+//             ended at or below.
+//Parameters:  - fraction: Fraction of sessions, e.g. 0.05 for the 5th
+//                         percentile.
+//------------------------------------------------------------------------------
+int Sessions::getBankrollPercentile(double fraction) const
+{
+    return getPercentile(this->bankrolls, fraction);
+} // end of getBankrollPercentile
+
+//----------------------------getLengthPercentile-------------------------------
+//Description: Returns the session length that the given fraction of sessions
+//             lasted at most.
+//Parameters:  - fraction: Fraction of sessions.
+//------------------------------------------------------------------------------
+int Sessions::getLengthPercentile(double fraction) const
+{
+    return getPercentile(this->lengths, fraction);
+} // end of getLengthPercentile
+
+//-------------------------------getPercentile----------------------------------
+//Description: Private function that returns the smallest value whose
+//             cumulative count reaches the given fraction of sessions.
+//Parameters:  - histogram: Sessions counted per value.
+//             - fraction:  Fraction of sessions.
+//------------------------------------------------------------------------------
+int Sessions::getPercentile(const vector<long long> &histogram, double fraction) const
+{
+    long long target = (long long) (fraction * this->sessions);
+    long long seen = 0;
+    for (int value = 0; value < (int) histogram.size(); value++)
+    {
+        seen += histogram[value];
+        if (seen > target || seen == this->sessions)
+        {
+            return value;
+        }
+    }
+    return 0;
+} // end of getPercentile
+
+//---------------------------------addSession-----------------------------------
+//Description: Counts a finished session.
+//Parameters:  - bankroll: Dollars left at the end.
+//             - rounds:   Rounds played.
+//             - ruin:     Whether or not the session ran out of money.
+//             - goal:     Whether or not the session reached its goal.
+//------------------------------------------------------------------------------
+void Sessions::addSession(int bankroll, int rounds, bool ruin, bool goal)
+{
+    this->sessions++;
+    this->ruined += ruin;
+    this->goals += goal;
+    this->rounds += rounds;
+    this->bankrollSum += bankroll;
+    this->bankrolls[min(max(bankroll, 0), (int) this->bankrolls.size() - 1)]++;
+    this->lengths[min(rounds, (int) this->lengths.size() - 1)]++;
+} // end of addSession
+
+//-----------------------------------merge--------------------------------------
+//Description: Adds another set of Sessions into this one.
+//Parameters:  - other: Sessions to add.
+//------------------------------------------------------------------------------
+void Sessions::merge(const Sessions &other)
+{
+    this->sessions += other.sessions;
+    this->ruined += other.ruined;
+    this->goals += other.goals;
+    this->rounds += other.rounds;
+    this->bankrollSum += other.bankrollSum;
+    for (int i = 0; i < (int) this->bankrolls.size() && i < (int) other.bankrolls.size(); i++)
+    {
+        this->bankrolls[i] += other.bankrolls[i];
+    }
+    for (int i = 0; i < (int) this->lengths.size() && i < (int) other.lengths.size(); i++)
+    {
+        this->lengths[i] += other.lengths[i];
+    }
+} // end of merge
@@ -0,0 +1,56 @@
+//--------------------------------Sessions.h------------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the header file for the Sessions class used by the
+//             simulator's bankroll mode. It accumulates the outcome of every
+//             session as it finishes, without keeping the sessions themselves:
+//             how many were ruined or reached their goal, and histograms of the
+//             final bankroll in dollars and of the session length in rounds.
+//             Both histograms are sized once from the session limits, so memory
+//             does not grow with the number of sessions, and exact percentiles
+//             are read from them. Sessions from different workers are merged
+//             by adding their histograms. SessionLimits holds the starting
+//             bankroll, the length limit and the goal every session shares.
+//------------------------------------------------------------------------------
+#ifndef SESSIONS_H
+#define SESSIONS_H
+#include <vector>
+#include <algorithm>
+using namespace std;
+
+struct SessionLimits
+{
+    int bankroll;       //Dollars a session starts with
+    int rounds;         //Most rounds a session lasts
+    int goal;           //Bankroll a session stops at once reached, 0 for none
+};
+
+class Sessions
+{
+    private:
+        long long sessions;             //Sessions played
+        long long ruined;               //Sessions that ran out of money
+        long long goals;                //Sessions that reached the goal
+        long long rounds;               //Rounds played in all sessions
+        long long bankrollSum;          //Sum of final bankrolls
+        vector<long long> bankrolls;    //Sessions ending on each bankroll in dollars
+        vector<long long> lengths;      //Sessions lasting each number of rounds
+        int getPercentile(const vector<long long> &histogram, double fraction) const;
+
+    public:
+        //Constructors
+        Sessions(int maxBankroll, int maxRounds);
+        //Getters
+        long long getSessions() const;
+        long long getRounds() const;
+        double getRiskOfRuin() const;
+        double getGoalRate() const;
+        double getMeanBankroll() const;
+        double getMeanLength() const;
+        int getBankrollPercentile(double fraction) const;
+        int getLengthPercentile(double fraction) const;
+        //Setters
+        void addSession(int bankroll, int rounds, bool ruin, bool goal);
+        void merge(const Sessions &other);
+};
+#endif
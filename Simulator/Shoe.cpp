@@ -0,0 +1,218 @@
+//-----------------------------------Shoe.cpp-----------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the implementation file for the Shoe class used by the
+//             headless simulator. It mirrors the Deck that Game uses as its
+//             shoe, but holds the ranks of the cards in a single array allocated
+//             once, so shuffling and drawing never create or destroy objects.
+//             It contains the array of ranks, the number of decks, the position
+//             of the next card, the Composition of the cards left to draw, a
+//             CardCounter for the cards dealt face up, and the random number
+//             generator used to shuffle. The class is used within Simulation.
+//------------------------------------------------------------------------------
+#include "Shoe.h"
+
+//------------------------------------Shoe--------------------------------------
+//Description: Constructor for a Shoe. Fills the shoe with the given number of
+//             decks and shuffles it.
+//Parameters:  - numDecks: Number of 52 card decks in the shoe.
+//             - seed:     Seed for the shuffling random number generator.
+//------------------------------------------------------------------------------
+Shoe::Shoe(const int numDecks, unsigned long long seed) : counter(HI_LO, numDecks), rng(seed)
+{
+    this->numDecks = numDecks;
+    this->size = numDecks * CARDS_PER_DECK;
+    this->cards = new unsigned char[this->size];
+    fill();
+    shuffle();
+} // end of Shoe
+
+//-----------------------------------fill---------------------------------------
+//Description: Private function that puts every card back in the shoe in deck
+//             order, so a shuffle from a given seed always deals the same cards.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+void Shoe::fill()
+{
+    int i = 0;
+    for (int deck = 0; deck < this->numDecks * SUITS_PER_DECK; deck++) //Every suit of every deck
+    {
+        for (int rank = ACE; rank < TEN; rank++)
+        {
+            this->cards[i++] = rank;
+        }
+        for (int face = 0; face < 4; face++) //10, J, Q and K
+        {
+            this->cards[i++] = TEN;
+        }
+    }
+    this->position = 0;
+    this->remaining = Composition(this->numDecks);
+    this->counter.reset(this->numDecks);
+    this->hiddenCards = 0;
+} // end of fill
+
+//-----------------------------------~Shoe--------------------------------------
+//Description: Destructor for a Shoe.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+Shoe::~Shoe()
+{
+    delete[] this->cards;
+} // end of ~Shoe
+
+//--------------------------------getRemaining----------------------------------
+//Description: Returns the number of cards left to draw.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+int Shoe::getRemaining() const
+{
+    return this->size - this->position;
+} // end of getRemaining
+
+//----------------------------------getSize-------------------------------------
+//Description: Returns the total number of cards in a full shoe.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+int Shoe::getSize() const
+{
+    return this->size;
+} // end of getSize
+
+//--------------------------------needsShuffle----------------------------------
+//Description: Returns true if the shoe is low enough on cards that Game would
+//             empty it and deal new decks before the next round.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+bool Shoe::needsShuffle() const
+{
+    return getRemaining() <= RESHUFFLE_POINT;
+} // end of needsShuffle
+
+//-------------------------------getComposition---------------------------------
+//Description: Returns the count of each rank left to draw.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+const Composition &Shoe::getComposition() const
+{
+    return this->remaining;
+} // end of getComposition
+
+//------------------------------getRunningCount---------------------------------
+//Description: Returns the running count of the cards dealt face up since the
+//             last shuffle.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+int Shoe::getRunningCount() const
+{
+    return this->counter.getRunningCount();
+} // end of getRunningCount
+
+//-------------------------------getTrueCount-----------------------------------
+//Description: Returns the running count per deck not yet seen, which includes
+//             any card still face down.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+double Shoe::getTrueCount() const
+{
+    return this->counter.getTrueCount(getRemaining() + this->hiddenCards);
+} // end of getTrueCount
+
+//----------------------------------getMark-------------------------------------
+//Description: Returns a Mark of the current point in the shoe.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+Shoe::Mark Shoe::getMark() const
+{
+    return Mark{ this->position, this->remaining, this->counter, this->hiddenCards };
+} // end of getMark
+
+//---------------------------------drawCard-------------------------------------
+//Description: Returns the rank of the next card in the shoe. A card dealt face
+//             down is counted once revealCard is called for it.
+//Parameters:  - visible: Whether or not the card is dealt face up.
+//------------------------------------------------------------------------------
+int Shoe::drawCard(bool visible)
+{
+    int rank = this->cards[this->position++];
+    this->remaining.removeCard(rank);
+    if (visible)
+    {
+        this->counter.addCard(rank);
+    }
+    else
+    {
+        this->hiddenCards++;
+    }
+    return rank;
+} // end of drawCard
+
+//--------------------------------revealCard------------------------------------
+//Description: Counts a card that was dealt face down once it is turned up.
+//Parameters:  - rank: Rank of the card.
+//------------------------------------------------------------------------------
+void Shoe::revealCard(int rank)
+{
+    if (this->hiddenCards > 0)
+    {
+        this->hiddenCards--;
+        this->counter.addCard(rank);
+    }
+} // end of revealCard
+
+//-----------------------------setCountingSystem--------------------------------
+//Description: Switches the counting system, recounting the cards already
+//             dealt face up. Face down cards are only known by their number,
+//             so switching is meant for between rounds.
+//Parameters:  - system: Counting system to use, e.g. HI_LO or KO.
+//------------------------------------------------------------------------------
+void Shoe::setCountingSystem(const CountingSystem &system)
+{
+    this->counter.setSystem(system, this->remaining);
+} // end of setCountingSystem
+
+//-----------------------------------rewind-------------------------------------
+//Description: Puts back every card drawn since the Mark was taken, so they are
+//             dealt again in the same order. The shoe must not have been
+//             shuffled since.
+//Parameters:  - mark: Point in the shoe to rewind to.
+//------------------------------------------------------------------------------
+void Shoe::rewind(const Mark &mark)
+{
+    this->position = mark.position;
+    this->remaining = mark.remaining;
+    this->counter = mark.counter;
+    this->hiddenCards = mark.hiddenCards;
+} // end of rewind
+
+//----------------------------------shuffle-------------------------------------
+//Description: Gathers every card back into the shoe and shuffles it in place
+//             (Fisher-Yates), without touching the heap.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+void Shoe::shuffle()
+{
+    for (int i = this->size - 1; i > 0; i--)
+    {
+        int j = (int) this->rng.bounded(i + 1);
+        unsigned char temp = this->cards[i];
+        this->cards[i] = this->cards[j];
+        this->cards[j] = temp;
+    }
+    this->position = 0;
+    this->remaining = Composition(this->numDecks);
+    this->counter.reset(this->numDecks);
+    this->hiddenCards = 0;
+} // end of shuffle
+
+//----------------------------------reseed--------------------------------------
+//Description: Switches the shuffling random number generator to the given
+//             stream and returns the cards to deck order, so a shoe can be
+//             replayed on its own from that stream.
+//Parameters:  - stream: Generator to shuffle with from now on.
+//------------------------------------------------------------------------------
+void Shoe::reseed(const Random &stream)
+{
+    this->rng = stream;
+    fill();
+} // end of reseed
@@ -0,0 +1,67 @@
+//-----------------------------------Shoe.h-------------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the header file for the Shoe class used by the headless
+//             simulator. It mirrors the Deck that Game uses as its shoe, but
+//             holds the ranks of the cards in a single array allocated once,
+//             so shuffling and drawing never create or destroy objects. It
+//             contains the array of ranks, the number of decks, the position
+//             of the next card, the Composition of the cards left to draw, a
+//             CardCounter for the cards dealt face up, and the random number
+//             generator used to shuffle. A Mark saves how far into the shoe
+//             dealing has gone so a round can be dealt again from the same
+//             cards. The class is used within Simulation.
+//------------------------------------------------------------------------------
+#ifndef SHOE_H
+#define SHOE_H
+#include "Hand.h"
+#include "Random.h"
+#include "Composition.h"
+#include "CardCounter.h"
+using namespace std;
+
+static const int RESHUFFLE_POINT = 52;      //Game::dealCards reshuffles when one deck or less remains
+
+class Shoe
+{
+    private:
+        unsigned char* cards;   //Ranks of every card in the shoe, in dealing order
+        int numDecks;           //Number of decks in the shoe
+        int size;               //Total number of cards in the shoe
+        int position;           //Index of the next card to draw
+        Composition remaining;  //Count of each rank left to draw
+        CardCounter counter;    //Running count of the cards dealt face up
+        int hiddenCards;        //Cards dealt face down and not yet revealed
+        Random rng;             //Random number generator for shuffling
+        void fill();
+
+    public:
+        //Point in the shoe to rewind to, everything the cards drawn since change
+        struct Mark
+        {
+            int position;           //Index of the next card to draw
+            Composition remaining;  //Count of each rank left to draw
+            CardCounter counter;    //Running count of the cards dealt face up
+            int hiddenCards;        //Cards dealt face down and not yet revealed
+        };
+        //Constructors
+        Shoe(const int numDecks, unsigned long long seed);
+        Shoe(const Shoe &shoe) = delete;
+        ~Shoe();
+        //Getters
+        int getRemaining() const;
+        int getSize() const;
+        bool needsShuffle() const;
+        const Composition &getComposition() const;
+        int getRunningCount() const;
+        double getTrueCount() const;
+        Mark getMark() const;
+        //Setters
+        int drawCard(bool visible = true);
+        void revealCard(int rank);
+        void setCountingSystem(const CountingSystem &system);
+        void rewind(const Mark &mark);
+        void shuffle();
+        void reseed(const Random &stream);
+};
+#endif
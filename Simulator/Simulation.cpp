@@ -0,0 +1,370 @@
+//-------------------------------Simulation.cpp---------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the implementation file for the Simulation class
+//             template. It plays rounds of Blackjack headlessly under the same
+//             rules as Game: every seat is dealt two cards, then the dealer an
+//             upcard and a hole card; each seat acts through its Strategy (hit,
+//             stand, surrender, or double down on the first action); the dealer
+//             draws to 17, or a soft 17 if the RulesPolicy hits it, and skips
+//             drawing when every seat has BUST; and bets settle as in
+//             Game::settleBets, a natural paid at the policy's rate. Every rule
+//             check is a compile-time constant of the policy, and an engine is
+//             instantiated at the end of the file for each named one. In bankroll
+//             sessions the first seat bets what a BettingSystem asks for. In
+//             paired shoes the Shoe is rewound after each Strategy's turn at a
+//             round so the next one is dealt the same cards. No sockets,
+//             strings, or heap allocation are used once the Simulation is
+//             constructed.
+//------------------------------------------------------------------------------
+#include "Simulation.h"
+
+//-----------------------------------~Engine------------------------------------
+//Description: Destructor for an Engine.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+Engine::~Engine()
+{
+} // end of ~Engine
+
+//---------------------------------Simulation-----------------------------------
+//Description: Constructor for a Simulation.
+//Parameters:  - strategy: Strategy every seat plays.
+//             - numSeats: Number of occupied seats, 1 to DEFAULT_NUM_SEATS.
+//             - seed:     Seed for shuffling the Shoe.
+//------------------------------------------------------------------------------
+template <class Rules>
+Simulation<Rules>::Simulation(const Strategy* strategy, int numSeats, unsigned long long seed)
+    : shoe(Rules::DECKS, seed)
+{
+    this->strategy = strategy;
+    this->numSeats = max(1, min(numSeats, DEFAULT_NUM_SEATS));
+    this->wager = BET_UNITS;
+    this->wagerLimit = BET_UNITS * 2;
+    this->tableNet = 0;
+} // end of Simulation
+
+//-----------------------------------create-------------------------------------
+//Description: Returns a new Simulation for the RulesPolicy as an Engine, the
+//             EngineFactory the Runner builds each worker's engine with.
+//Parameters:  - strategy: Strategy every seat plays.
+//             - numSeats: Number of occupied seats, 1 to DEFAULT_NUM_SEATS.
+//             - seed:     Seed for shuffling the Shoe.
+//------------------------------------------------------------------------------
+template <class Rules>
+Engine* Simulation<Rules>::create(const Strategy* strategy, int numSeats, unsigned long long seed)
+{
+    return new Simulation<Rules>(strategy, numSeats, seed);
+} // end of create
+
+//--------------------------------getResults------------------------------------
+//Description: Returns the Results of every round played so far.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+template <class Rules>
+const Results &Simulation<Rules>::getResults() const
+{
+    return this->results;
+} // end of getResults
+
+//-------------------------------getTrueCount-----------------------------------
+//Description: Returns the true count the next round will be dealt under; a
+//             shoe about to be reshuffled counts as a fresh one.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+template <class Rules>
+double Simulation<Rules>::getTrueCount() const
+{
+    return this->shoe.needsShuffle() ? 0 : this->shoe.getTrueCount();
+} // end of getTrueCount
+
+//------------------------------------run---------------------------------------
+//Description: Plays the given number of rounds.
+//Parameters:  - rounds: Number of rounds to play.
+//------------------------------------------------------------------------------
+template <class Rules>
+void Simulation<Rules>::run(long long rounds)
+{
+    for (long long i = 0; i < rounds; i++)
+    {
+        playRound();
+    }
+} // end of run
+
+//---------------------------------playShoe-------------------------------------
+//Description: Shuffles a fresh shoe from the given random stream and plays
+//             rounds until Game would reshuffle. A shoe is the unit of work
+//             handed out by the Runner, so its result depends only on its
+//             stream.
+//Parameters:  - stream: Random substream for shuffling the shoe.
+//------------------------------------------------------------------------------
+template <class Rules>
+void Simulation<Rules>::playShoe(const Random &stream)
+{
+    this->shoe.reseed(stream);
+    this->shoe.shuffle();
+    do
+    {
+        playRound();
+    } while (!this->shoe.needsShuffle());
+} // end of playShoe
+
+//-------------------------------playPairedShoe---------------------------------
+//Description: Shuffles a fresh shoe from the given random stream and plays
+//             rounds until Game would reshuffle, dealing every round once with
+//             the Simulation's own Strategy and once with each rival from the
+//             same cards. Play then carries on from whichever turn drew the
+//             most cards, so no card is dealt twice in one turn's future.
+//             Each round's net results are counted in the given Comparison.
+//Parameters:  - stream:     Random substream for shuffling the shoe.
+//             - rivals:     Strategies compared against the Simulation's own.
+//             - numRivals:  Number of rivals, below MAX_COMPARED.
+//             - comparison: Receives every paired round.
+//------------------------------------------------------------------------------
+template <class Rules>
+void Simulation<Rules>::playPairedShoe(const Random &stream, const Strategy* const rivals[], int numRivals, Comparison &comparison)
+{
+    const Strategy* baseline = this->strategy;
+    int nets[MAX_COMPARED];
+    this->shoe.reseed(stream);
+    this->shoe.shuffle();
+    do
+    {
+        Shoe::Mark start = this->shoe.getMark();
+        Shoe::Mark furthest = start;
+        for (int i = 0; i <= numRivals; i++)
+        {
+            this->strategy = i == 0 ? baseline : rivals[i - 1];
+            this->shoe.rewind(start);
+            playRound();
+            nets[i] = this->tableNet;
+            if (this->shoe.getRemaining() < this->shoe.getSize() - furthest.position)
+            {
+                furthest = this->shoe.getMark();
+            }
+        }
+        this->shoe.rewind(furthest);
+        comparison.addRound(nets);
+    } while (!this->shoe.needsShuffle());
+    this->strategy = baseline;
+} // end of playPairedShoe
+
+//--------------------------------playSession-----------------------------------
+//Description: Plays one bankroll session from a fresh shoe shuffled from the
+//             given random stream. Before each round the BettingSystem sizes the
+//             first seat's bet, clamped to MINIMUM_BET..MAXIMUM_BET and to the
+//             bankroll, and a double down is capped at the bankroll as in
+//             Game::doubleDown. The session ends when the bankroll can't cover
+//             the minimum bet (ruin), the goal is reached, or the round limit
+//             is played, and is then counted in the given Sessions.
+//Parameters:  - stream:   Random substream for shuffling the shoe.
+//             - betting:  BettingSystem sizing every bet.
+//             - limits:   Starting bankroll, round limit and goal.
+//             - sessions: Receives the finished session.
+//------------------------------------------------------------------------------
+template <class Rules>
+void Simulation<Rules>::playSession(const Random &stream, const BettingSystem* betting, const SessionLimits &limits, Sessions &sessions)
+{
+    this->shoe.reseed(stream);
+    this->shoe.shuffle();
+    BettingState state = { limits.bankroll, 0, 0, 0, 0 };
+    int rounds = 0;
+    bool goal = false;
+    while (rounds < limits.rounds && state.bankroll >= MINIMUM_BET && !goal)
+    {
+        state.trueCount = getTrueCount();
+        int bet = min(max(betting->getBet(state), MINIMUM_BET), MAXIMUM_BET);
+        bet = min(bet, state.bankroll);
+        this->wager = bet * BET_UNITS;
+        this->wagerLimit = state.bankroll * BET_UNITS;
+        int net = playRound() / BET_UNITS; //Dollars, a surrender or 6:5 natural rounds as Game::settleBets does
+        state.bankroll += net;
+        state.streak = net > 0 ? state.streak + 1 : (net < 0 ? 0 : state.streak);
+        state.lastBet = bet;
+        state.lastNet = net;
+        rounds++;
+        goal = limits.goal > 0 && state.bankroll >= limits.goal;
+    }
+    sessions.addSession(state.bankroll, rounds, state.bankroll < MINIMUM_BET, goal);
+} // end of playSession
+
+//---------------------------------playRound------------------------------------
+//Description: Plays a full round: deal, every seat's turn, the dealer's turn,
+//             and settling the bets. Returns the first seat's net result in
+//             BET_UNITS.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+template <class Rules>
+int Simulation<Rules>::playRound()
+{
+    dealCards();
+    for (int i = 0; i < this->numSeats; i++)
+    {
+        playHand(i);
+    }
+    dealerActions();
+    int net = settleBets();
+    this->results.addRound();
+    return net;
+} // end of playRound
+
+//---------------------------------dealCards------------------------------------
+//Description: Private function that reshuffles the Shoe when Game would, then
+//             deals two cards to every seat followed by the dealer's upcard and
+//             hole card.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+template <class Rules>
+void Simulation<Rules>::dealCards()
+{
+    if (this->shoe.needsShuffle())
+    {
+        this->shoe.shuffle();
+    }
+    for (int i = 0; i < this->numSeats; i++)
+    {
+        this->hands[i].clear();
+        this->hands[i].addCard(this->shoe.drawCard());
+        this->hands[i].addCard(this->shoe.drawCard());
+        this->bets[i] = this->wager;
+        this->surrendered[i] = false;
+    }
+    this->dealerHand.clear();
+    this->dealerHand.addCard(this->shoe.drawCard());
+    this->holeCard = this->shoe.drawCard(false);
+    this->dealerHand.addCard(this->holeCard);
+} // end of dealCards
+
+//----------------------------------playHand------------------------------------
+//Description: Private function that lets the seat's Strategy act until it
+//             stands, BUSTs, surrenders, or doubles down. A double down asked
+//             for after the first action is played as a hit, and so is a
+//             surrender the policy's late surrender no longer allows.
+//Parameters:  - seat: Index of the seat taking its turn.
+//------------------------------------------------------------------------------
+template <class Rules>
+void Simulation<Rules>::playHand(int seat)
+{
+    Hand &hand = this->hands[seat];
+    int upcard = this->dealerHand.getFirstRank();
+    bool firstAction = true;
+    while (!hand.isBust())
+    {
+        Composition unseen(this->shoe.getComposition()); //The hole card is still unseen
+        unseen.addCard(this->holeCard);
+        switch (this->strategy->decide(hand, upcard, firstAction, unseen))
+        {
+            case Decision::STAND:
+                return;
+            case Decision::SURRENDER:
+                if (Rules::canSurrender(firstAction))
+                {
+                    this->surrendered[seat] = true;
+                    return;
+                }
+                hand.addCard(this->shoe.drawCard()); //Too late to surrender, take the card as a hit
+                break;
+            case Decision::DOUBLE_DOWN:
+                if (firstAction)
+                {
+                    this->bets[seat] = min(this->bets[seat] * 2, this->wagerLimit);
+                    hand.addCard(this->shoe.drawCard());
+                    return;
+                }
+                hand.addCard(this->shoe.drawCard()); //Too late to double down, take the card as a hit
+                break;
+            case Decision::HIT:
+                hand.addCard(this->shoe.drawCard());
+                break;
+        }
+        firstAction = false;
+    }
+} // end of playHand
+
+//-------------------------------dealerActions----------------------------------
+//Description: Private function for the dealer's turn, as in Game::dealerActions:
+//             a natural stands, nothing is drawn if every seat has BUST, and
+//             otherwise the dealer hits until reaching 17, or past a soft 17
+//             if the policy hits it.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+template <class Rules>
+void Simulation<Rules>::dealerActions()
+{
+    this->shoe.revealCard(this->holeCard);
+    if (this->dealerHand.isNatural())
+    {
+        return;
+    }
+    int bustCount = 0;
+    for (int i = 0; i < this->numSeats; i++)
+    {
+        bustCount += this->hands[i].isBust();
+    }
+    if (bustCount == this->numSeats)
+    {
+        return;
+    }
+    while (Rules::dealerHits(this->dealerHand.getPoints(), this->dealerHand.isSoft()))
+    {
+        this->dealerHand.addCard(this->shoe.drawCard());
+    }
+} // end of dealerActions
+
+//---------------------------------settleBets-----------------------------------
+//Description: Private function to settle each seat's bet as Game::settleBets
+//             does: surrender loses half (all of it against a dealer natural
+//             under late surrender), BUST loses, a dealer BUST or higher total
+//             wins even money or the policy's rate on a natural, and equal
+//             totals push. Returns the first seat's net result in BET_UNITS and
+//             keeps every seat's total.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+template <class Rules>
+int Simulation<Rules>::settleBets()
+{
+    int firstNet = 0;
+    this->tableNet = 0;
+    int dealerPoints = this->dealerHand.getPoints();
+    for (int i = 0; i < this->numSeats; i++)
+    {
+        const Hand &hand = this->hands[i];
+        int net;
+        if (this->surrendered[i] && Rules::LATE_SURRENDER && this->dealerHand.isNatural())
+        {
+            net = -this->bets[i];
+        }
+        else if (this->surrendered[i])
+        {
+            net = -this->bets[i] / 2;
+        }
+        else if (hand.isBust())
+        {
+            net = -this->bets[i];
+        }
+        else if (this->dealerHand.isBust() || hand.getPoints() > dealerPoints)
+        {
+            net = hand.isNatural() ? Rules::naturalWin(this->bets[i]) : this->bets[i];
+        }
+        else if (hand.getPoints() == dealerPoints)
+        {
+            net = 0;
+        }
+        else
+        {
+            net = -this->bets[i];
+        }
+        this->results.addHand(net, hand.isBust(), this->bets[i] > this->wager, this->surrendered[i]);
+        this->tableNet += net;
+        if (i == 0)
+        {
+            firstNet = net;
+        }
+    }
+    return firstNet;
+} // end of settleBets
+
+template class Simulation<HouseRules>;
+template class Simulation<StripRules>;
+template class Simulation<DowntownRules>;
+template class Simulation<SixFiveRules>;
@@ -0,0 +1,73 @@
+//--------------------------------Simulation.h----------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the header file for the Engine interface and the
+//             Simulation class template. A Simulation plays rounds of Blackjack
+//             headlessly under the same rules as Game, with the rule variant
+//             compiled in as its RulesPolicy. It contains the Shoe, the
+//             Strategy, the seats' Hands, bets and flags, the dealer's Hand,
+//             and the Results.
+//------------------------------------------------------------------------------
+#ifndef SIMULATION_H
+#define SIMULATION_H
+#include "Game.h"
+#include "Hand.h"
+#include "Shoe.h"
+#include "Strategy.h"
+#include "Results.h"
+#include "Betting.h"
+#include "Sessions.h"
+#include "Comparison.h"
+using namespace std;
+
+//A Simulation of any RulesPolicy, as the Runner sees it
+class Engine
+{
+    public:
+        virtual ~Engine();
+        //Getters
+        virtual const Results &getResults() const = 0;
+        //Setters
+        virtual void playShoe(const Random &stream) = 0;
+        virtual void playPairedShoe(const Random &stream, const Strategy* const rivals[], int numRivals, Comparison &comparison) = 0;
+        virtual void playSession(const Random &stream, const BettingSystem* betting, const SessionLimits &limits, Sessions &sessions) = 0;
+};
+
+//Creates the Engine for one RulesPolicy, see Simulation::create
+typedef Engine* (*EngineFactory)(const Strategy* strategy, int numSeats, unsigned long long seed);
+
+template <class Rules>
+class Simulation : public Engine
+{
+    private:
+        Shoe shoe;                              //Cards for every round
+        const Strategy* strategy;               //Strategy every seat plays
+        int numSeats;                           //Number of occupied seats
+        Hand hands[DEFAULT_NUM_SEATS];          //Each seat's hand
+        int bets[DEFAULT_NUM_SEATS];            //Each seat's bet in BET_UNITS
+        bool surrendered[DEFAULT_NUM_SEATS];    //Whether or not each seat surrendered
+        Hand dealerHand;                        //Dealer's hand
+        int holeCard;                           //Rank of the dealer's face down card
+        int wager;                              //Every seat's initial bet in BET_UNITS
+        int wagerLimit;                         //Most a seat can have bet after doubling down
+        int tableNet;                           //Every seat's net result last round in BET_UNITS
+        Results results;                        //Outcomes of every hand played
+        void dealCards();
+        void playHand(int seat);
+        void dealerActions();
+        int settleBets();
+
+    public:
+        Simulation(const Strategy* strategy, int numSeats, unsigned long long seed);
+        static Engine* create(const Strategy* strategy, int numSeats, unsigned long long seed);
+        //Getters
+        const Results &getResults() const;
+        double getTrueCount() const;
+        //Setters
+        int playRound();
+        void playShoe(const Random &stream);
+        void playPairedShoe(const Random &stream, const Strategy* const rivals[], int numRivals, Comparison &comparison);
+        void playSession(const Random &stream, const BettingSystem* betting, const SessionLimits &limits, Sessions &sessions);
+        void run(long long rounds);
+};
+#endif
@@ -0,0 +1,643 @@
+/*
+* Simulator.cpp
+*
+* CSS 432 Group Lucky No 13
+*
+* Headless Monte Carlo simulation of the Game's rules
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <iostream>
+#include <unistd.h>
+#include "Simulation.h"
+#include "Runner.h"
+#include "RunController.h"
+#include "DealerOdds.h"
+#include "StrategyChart.h"
+
+#pragma region Options
+
+/*
+* Command line flags
+*/
+namespace Flag {
+	constexpr auto ROUNDS = "--rounds",
+		STRATEGY = "--strategy",
+		RULES = "--rules",
+		SHOES = "--shoes",
+		SEATS = "--seats",
+		SEED = "--seed",
+		THREADS = "--threads",
+		COMPARE = "--compare",
+		PRECISION = "--precision",
+		CHECKPOINT = "--checkpoint",
+		RESUME = "--resume",
+		SESSIONS = "--sessions",
+		BETTING = "--betting",
+		SESSION_ROUNDS = "--session-rounds",
+		GOAL = "--goal",
+		DEALER_ODDS = "--dealer-odds",
+		BASIC_STRATEGY = "--basic-strategy";
+}
+
+/*
+* Defaults for the simulation
+*/
+namespace Sim {
+	constexpr auto ROUNDS = 10000000LL;
+	constexpr auto SEATS = 1;
+	constexpr auto STRATEGY = "dealer";
+	constexpr auto RULES = "house";
+	constexpr auto BETTING = "flat";
+	constexpr auto SESSION_ROUNDS = 1000;
+
+	// Shoe indexes are packed in 32 bits by the Runner
+	constexpr auto MAX_SHOES = 0xFFFFFFFFLL;
+}
+
+/*
+* Output and usage
+*/
+namespace Report {
+	constexpr auto USAGE = "usage: ./simulator [--rounds N | --shoes N] [--precision P] [--strategy dealer|nobust|optimal|basic] "
+		"[--rules house|strip|downtown|sixfive] [--seats 1-4] [--seed N] [--threads N] [--checkpoint FILE]\n"
+		"       ./simulator --resume FILE [--threads N] [--checkpoint FILE]\n"
+		"       ./simulator --compare strategy[,strategy...] [--strategy baseline] [--rounds N | --shoes N] "
+		"[--rules ...] [--seats 1-4] [--seed N] [--threads N]\n"
+		"       ./simulator --sessions N [--betting flat|ramp|martingale|paroli] [--session-rounds N] [--goal N] "
+		"[--strategy ...] [--rules ...] [--seats 1-4] [--seed N] [--threads N]\n"
+		"       ./simulator --dealer-odds\n"
+		"       ./simulator --basic-strategy > ../Server/BasicStrategy.h\n",
+		BAD_STRATEGY = "Unknown strategy: %s\n",
+		BAD_BETTING = "Unknown betting system: %s\n",
+		BAD_CHECKPOINT = "Unable to read checkpoint: %s\n",
+		BAD_COMPARE = "At most %d strategies can be compared with the baseline\n",
+		BAD_RULES = "Unknown rules: %s\n",
+		RULES = "Rules: %s (%d decks, dealer %s soft 17, double down, surrender %s, naturals pay %d:%d)\n",
+		HITS = "hits",
+		STANDS = "stands on",
+		FIRST_ONLY = "first action only",
+		ANY_TIME = "any time",
+		RUN = "Strategy: %s   Seats: %d   Seed: %llu   Threads: %d\n\n",
+		RESUMED = "Resumed:        %lld hands from %s\n",
+		SHOES = "Shoes:          %lld\n",
+		ROUNDS = "Rounds:         %lld\n",
+		HANDS = "Hands:          %lld\n",
+		OUTCOMES = "Wins / Losses / Pushes:  %.4f / %.4f / %.4f\n",
+		ACTIONS = "Busts / Doubles / Surrenders:  %.4f / %.4f / %.4f\n",
+		EDGE = "House edge:     %+.4f%% (+/- %.4f%% at 95%%)\n",
+		VARIANCE = "Variance:       %.4f (std dev %.4f)\n",
+		PRECISION = "Target:         +/- %.4f%% at 95%%, %s\n",
+		REACHED = "reached",
+		NOT_REACHED = "not reached before the shoe limit",
+		SPEED = "Throughput:     %.2f million hands/second (%.2fs)\n",
+		PAIRED_RUN = "Baseline: %s   Seats: %d   Seed: %llu   Threads: %d\n\n",
+		PAIRED_COUNT = "Shoes:          %lld\nRounds:         %lld per strategy, dealt the same cards\n\n",
+		PAIRED_HEADER = "Strategy     House edge   Gain vs baseline (95%%)   Correlation   Unpaired (95%%)   Rounds saved\n",
+		PAIRED_BASELINE = "%-10s  %+9.4f%%\n",
+		PAIRED_ROW = "%-10s  %+9.4f%%   %+9.4f%% +/- %.4f%%   %11.4f   +/- %.4f%%   %10.1fx\n",
+		PAIRED_SPEED = "\nThroughput:     %.2f million hands/second over every strategy (%.2fs)\n",
+		SESSION_RUN = "Strategy: %s   Betting: %s   Seats: %d   Seed: %llu   Threads: %d\n",
+		SESSION_LIMITS = "Bankroll: $%d   Bets: $%d-$%d   Rounds per session: %d   Goal: ",
+		SESSION_GOAL = "$%d\n\n",
+		SESSION_NO_GOAL = "none\n\n",
+		SESSION_COUNT = "Sessions:       %lld (%lld rounds)\n",
+		RUIN = "Risk of ruin:   %.4f%%\n",
+		GOAL_RATE = "Reached goal:   %.4f%%\n",
+		PERCENTILE_HEADER = "                    Mean      5th     25th   Median     75th     95th\n",
+		BANKROLL_ROW = "Final bankroll  %8.2f",
+		LENGTH_ROW = "Session length  %8.2f",
+		PERCENTILE_CELL = " %8d",
+		SESSION_SPEED = "\nThroughput:     %.2f thousand sessions/second (%.2fs)\n",
+		ODDS_TITLE = "Dealer final totals from a full %d deck shoe (stands on 17)\n\n",
+		ODDS_HEADER = "Upcard      17      18      19      20      21    Bust   (Natural)\n",
+		ODDS_UPCARD = "%6s",
+		ODDS_CELL = "  %6.4f",
+		ODDS_NATURAL = "   (%6.4f)\n",
+		ODDS_SPEED = "\nCached subproblems: %d   Warm query: %.2f microseconds\n";
+}
+
+/*
+* Options chosen on the command line
+*/
+struct Options {
+	long long rounds{Sim::ROUNDS}, shoes{0};
+	bool limited{false};
+	double precision{0};
+	std::string checkpoint, resume;
+	int seats{Sim::SEATS};
+	int threads{(int) sysconf(_SC_NPROCESSORS_ONLN)};
+	unsigned long long seed{(unsigned long long)
+		std::chrono::system_clock::now().time_since_epoch().count()};
+	std::string strategy{Sim::STRATEGY};
+	std::string rules{Sim::RULES};
+	std::string compare;
+	long long sessions{0};
+	int sessionRounds{Sim::SESSION_ROUNDS}, goal{0};
+	std::string betting{Sim::BETTING};
+	bool dealerOdds{false};
+	bool basicStrategy{false};
+};
+
+/*
+* Print usage and exit
+*/
+void usage() {
+	printf(Report::USAGE);
+	exit(EXIT_FAILURE);
+}
+
+/*
+* Rule variant's description and the engine built for it
+*/
+struct Variant {
+	const TableRules* rules;
+	EngineFactory engine;
+};
+
+/*
+* Built in rule variants by name
+*/
+const Variant* getVariant(const std::string* name) {
+
+	static const std::map<std::string, Variant> variants{
+		{ HOUSE_RULES.name, { &HOUSE_RULES, &Simulation<HouseRules>::create } },
+		{ STRIP_RULES.name, { &STRIP_RULES, &Simulation<StripRules>::create } },
+		{ DOWNTOWN_RULES.name, { &DOWNTOWN_RULES, &Simulation<DowntownRules>::create } },
+		{ SIX_FIVE_RULES.name, { &SIX_FIVE_RULES, &Simulation<SixFiveRules>::create } }
+	};
+
+	auto variant = variants.find(*name);
+	if (variant == variants.end()) {
+		printf(Report::BAD_RULES, name->c_str());
+		usage();
+	}
+	return &variant->second;
+}
+
+/*
+* Read the flags given on the command line
+*/
+Options parseOptions(int argc, char* argv[]) {
+
+	Options options;
+	for (int i = 1; i < argc; i++) {
+
+		if (strcmp(argv[i], Flag::DEALER_ODDS) == 0) {
+			options.dealerOdds = true;
+			continue;
+		}
+		if (strcmp(argv[i], Flag::BASIC_STRATEGY) == 0) {
+			options.basicStrategy = true;
+			continue;
+		}
+		if (i + 1 >= argc) {
+			usage();
+		}
+		const char* value = argv[++i];
+
+		if (strcmp(argv[i - 1], Flag::ROUNDS) == 0) {
+			options.rounds = atoll(value);
+			options.limited = true;
+		}
+		else if (strcmp(argv[i - 1], Flag::SHOES) == 0) {
+			options.shoes = atoll(value);
+			options.limited = true;
+		}
+		else if (strcmp(argv[i - 1], Flag::PRECISION) == 0) {
+			options.precision = atof(value);
+		}
+		else if (strcmp(argv[i - 1], Flag::CHECKPOINT) == 0) {
+			options.checkpoint = value;
+		}
+		else if (strcmp(argv[i - 1], Flag::RESUME) == 0) {
+			options.resume = value;
+		}
+		else if (strcmp(argv[i - 1], Flag::THREADS) == 0) {
+			options.threads = atoi(value);
+		}
+		else if (strcmp(argv[i - 1], Flag::STRATEGY) == 0) {
+			options.strategy = value;
+		}
+		else if (strcmp(argv[i - 1], Flag::RULES) == 0) {
+			options.rules = value;
+		}
+		else if (strcmp(argv[i - 1], Flag::COMPARE) == 0) {
+			options.compare = value;
+		}
+		else if (strcmp(argv[i - 1], Flag::SEATS) == 0) {
+			options.seats = atoi(value);
+		}
+		else if (strcmp(argv[i - 1], Flag::SEED) == 0) {
+			options.seed = strtoull(value, nullptr, 10);
+		}
+		else if (strcmp(argv[i - 1], Flag::SESSIONS) == 0) {
+			options.sessions = atoll(value);
+		}
+		else if (strcmp(argv[i - 1], Flag::BETTING) == 0) {
+			options.betting = value;
+		}
+		else if (strcmp(argv[i - 1], Flag::SESSION_ROUNDS) == 0) {
+			options.sessionRounds = std::max(1, atoi(value));
+		}
+		else if (strcmp(argv[i - 1], Flag::GOAL) == 0) {
+			options.goal = std::max(0, atoi(value));
+		}
+		else {
+			usage();
+		}
+	}
+	return options;
+}
+
+/*
+* Most shoes to play, the shoes asked for or otherwise
+* as many as the rounds or target precision take
+*/
+long long shoeCount(const Options* options) {
+	return options->shoes > 0 ? std::min(options->shoes, Sim::MAX_SHOES) : Sim::MAX_SHOES;
+}
+
+/*
+* Rounds to play, rounded up to whole shoes; none when shoes
+* were asked for or a target precision was given with no limit
+*/
+long long roundCount(const Options* options) {
+	bool unlimited = options->precision > 0 && !options->limited;
+	return options->shoes > 0 || unlimited ? 0 : options->rounds;
+}
+
+/*
+* Take the settings of the run being resumed from its checkpoint,
+* which keeps being checkpointed unless another file is given
+*/
+void resumeOptions(Options* options) {
+
+	RunSettings settings;
+	if (!RunController::readSettings(options->resume, &settings)) {
+		printf(Report::BAD_CHECKPOINT, options->resume.c_str());
+		exit(EXIT_FAILURE);
+	}
+	options->seed = settings.seed;
+	options->seats = settings.numSeats;
+	options->strategy = settings.strategy;
+	options->rules = settings.rules;
+	options->precision = settings.precision;
+	options->shoes = settings.rounds > 0 ? 0 : settings.maxShoes;
+	options->rounds = settings.rounds;
+	options->limited = true;
+	if (options->checkpoint.empty()) {
+		options->checkpoint = options->resume;
+	}
+}
+
+/*
+* Settings that decide the run, written with every checkpoint
+*/
+RunSettings runSettings(const Options* options, long long shoes) {
+
+	RunSettings settings;
+	memset(&settings, 0, sizeof(settings));
+	settings.seed = options->seed;
+	settings.numSeats = options->seats;
+	strncpy(settings.strategy, options->strategy.c_str(), SETTING_NAME - 1);
+	strncpy(settings.rules, options->rules.c_str(), SETTING_NAME - 1);
+	settings.precision = options->precision;
+	settings.maxShoes = shoes;
+	settings.rounds = roundCount(options);
+	return settings;
+}
+
+#pragma endregion
+
+#pragma region Strategies
+
+/*
+* Built in strategies by name for the rules played,
+* the optimal strategy's caches are sized by the decks in the shoe
+*/
+const Strategy* getStrategy(const std::string* name, const std::string* rules) {
+
+	static const DealerStrategy dealer;
+	static const NoBustStrategy noBust;
+	static const BasicStrategy basic;
+	static std::map<int, OptimalStrategy> optimal;
+
+	int decks = getVariant(rules)->rules->decks;
+	const std::map<std::string, const Strategy*> strategies{
+		{ "dealer", &dealer },
+		{ "nobust", &noBust },
+		{ "optimal", &optimal.emplace(decks, decks).first->second },
+		{ "basic", &basic }
+	};
+
+	auto strategy = strategies.find(*name);
+	if (strategy == strategies.end()) {
+		printf(Report::BAD_STRATEGY, name->c_str());
+		usage();
+	}
+	return strategy->second;
+}
+
+/*
+* Built in betting systems by name
+*/
+const BettingSystem* getBetting(const std::string* name) {
+
+	static const FlatBetting flat;
+	static const CountRamp ramp;
+	static const Martingale martingale;
+	static const Paroli paroli;
+	static const std::map<std::string, const BettingSystem*> systems{
+		{ "flat", &flat },
+		{ "ramp", &ramp },
+		{ "martingale", &martingale },
+		{ "paroli", &paroli }
+	};
+
+	auto system = systems.find(*name);
+	if (system == systems.end()) {
+		printf(Report::BAD_BETTING, name->c_str());
+		usage();
+	}
+	return system->second;
+}
+
+#pragma endregion
+
+#pragma region Report
+
+/*
+* Print the rules the run is played by
+*/
+void reportRules(const Options* options) {
+
+	const TableRules* rules = getVariant(&options->rules)->rules;
+	printf(Report::RULES, rules->name, rules->decks, rules->hitSoft17 ? Report::HITS : Report::STANDS,
+		rules->lateSurrender ? Report::FIRST_ONLY : Report::ANY_TIME, rules->naturalPays, rules->naturalPer);
+}
+
+/*
+* Print the rules, the run's settings and the results
+*/
+void report(const Options* options, const RunController* controller, const Results* results, double seconds) {
+
+	double hands = results->getHands();
+	double margin = 1.96 * results->getStandardError() * 100;
+
+	reportRules(options);
+	printf(Report::RUN, options->strategy.c_str(), options->seats, options->seed, options->threads);
+	if (controller->getResumedHands() > 0) {
+		printf(Report::RESUMED, controller->getResumedHands(), options->resume.c_str());
+	}
+	printf(Report::SHOES, controller->getShoes());
+	printf(Report::ROUNDS, results->getRounds());
+	printf(Report::HANDS, results->getHands());
+	printf(Report::OUTCOMES, results->getWins() / hands,
+		results->getLosses() / hands, results->getPushes() / hands);
+	printf(Report::ACTIONS, results->getBusts() / hands,
+		results->getDoubles() / hands, results->getSurrenders() / hands);
+	printf(Report::EDGE, results->getHouseEdge() * 100, margin);
+	printf(Report::VARIANCE, results->getVariance(), results->getStandardDeviation());
+	if (options->precision > 0) {
+		printf(Report::PRECISION, options->precision,
+			controller->reachedPrecision() ? Report::REACHED : Report::NOT_REACHED);
+	}
+	printf(Report::SPEED, (hands - controller->getResumedHands()) / seconds / 1e6, seconds);
+}
+
+/*
+* Print every strategy's house edge and its paired difference
+* from the baseline next to what unpaired runs would have resolved
+*/
+void reportPaired(const Options* options, long long shoes, const std::vector<std::string>* names,
+	const Comparison* comparison, double seconds) {
+
+	reportRules(options);
+	printf(Report::PAIRED_RUN, options->strategy.c_str(), options->seats, options->seed, options->threads);
+	printf(Report::PAIRED_COUNT, shoes, comparison->getRounds());
+	printf(Report::PAIRED_HEADER);
+	printf(Report::PAIRED_BASELINE, options->strategy.c_str(), comparison->getHouseEdge(0) * 100);
+
+	for (int i = 1; i < comparison->getNumStrategies(); i++) {
+		double paired = comparison->getDifferenceError(i);
+		double unpaired = comparison->getIndependentError(i);
+		double saved = paired > 0 ? (unpaired * unpaired) / (paired * paired) : 0;
+		printf(Report::PAIRED_ROW, (*names)[i - 1].c_str(), comparison->getHouseEdge(i) * 100,
+			comparison->getDifference(i) * 100, 1.96 * paired * 100,
+			comparison->getCorrelation(i), 1.96 * unpaired * 100, saved);
+	}
+	double hands = (double) comparison->getHands() * comparison->getNumStrategies();
+	printf(Report::PAIRED_SPEED, hands / seconds / 1e6, seconds);
+}
+
+/*
+* Print a row of the mean and the percentiles read by the given getter
+*/
+void reportPercentiles(const char* row, double mean, const Sessions* sessions,
+	int (Sessions::*percentile)(double) const) {
+
+	const double fractions[] = { 0.05, 0.25, 0.5, 0.75, 0.95 };
+	printf(row, mean);
+	for (double fraction : fractions) {
+		printf(Report::PERCENTILE_CELL, (sessions->*percentile)(fraction));
+	}
+	printf("\n");
+}
+
+/*
+* Print the session settings, risk of ruin and the
+* distributions of final bankroll and session length
+*/
+void reportSessions(const Options* options, const SessionLimits* limits, const Sessions* sessions, double seconds) {
+
+	reportRules(options);
+	printf(Report::SESSION_RUN, options->strategy.c_str(), options->betting.c_str(),
+		options->seats, options->seed, options->threads);
+	printf(Report::SESSION_LIMITS, limits->bankroll, MINIMUM_BET, MAXIMUM_BET, limits->rounds);
+	if (limits->goal > 0) {
+		printf(Report::SESSION_GOAL, limits->goal);
+	}
+	else {
+		printf(Report::SESSION_NO_GOAL);
+	}
+	printf(Report::SESSION_COUNT, sessions->getSessions(), sessions->getRounds());
+	printf(Report::RUIN, sessions->getRiskOfRuin() * 100);
+	if (limits->goal > 0) {
+		printf(Report::GOAL_RATE, sessions->getGoalRate() * 100);
+	}
+	printf(Report::PERCENTILE_HEADER);
+	reportPercentiles(Report::BANKROLL_ROW, sessions->getMeanBankroll(), sessions, &Sessions::getBankrollPercentile);
+	reportPercentiles(Report::LENGTH_ROW, sessions->getMeanLength(), sessions, &Sessions::getLengthPercentile);
+	printf(Report::SESSION_SPEED, sessions->getSessions() / seconds / 1e3, seconds);
+}
+
+/*
+* Play bankroll sessions on every thread and report them
+*/
+void runSessions(Options* options) {
+
+	SessionLimits limits;
+	limits.bankroll = DEFAULT_BALANCE;
+	limits.rounds = options->sessionRounds;
+	limits.goal = options->goal;
+
+	// Highest a bankroll can reach: a doubled maximum bet won every round
+	int maxBankroll = (limits.goal > 0 ? limits.goal : limits.bankroll + limits.rounds * 2 * MAXIMUM_BET)
+		+ 2 * MAXIMUM_BET;
+	const BettingSystem* betting = getBetting(&options->betting);
+	long long sessions = std::min(options->sessions, Sim::MAX_SHOES);
+
+	Runner runner{getVariant(&options->rules)->engine, getStrategy(&options->strategy, &options->rules), options->seats, options->seed, options->threads};
+	options->threads = runner.getNumThreads();
+
+	auto start = std::chrono::steady_clock::now();
+	Sessions results{runner.runSessions(sessions, betting, limits, maxBankroll)};
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+	reportSessions(options, &limits, &results, elapsed.count());
+}
+
+/*
+* Play every round of every shoe once per compared strategy
+* from the same cards and report the paired differences
+*/
+void runPaired(Options* options) {
+
+	std::vector<std::string> names;
+	std::vector<const Strategy*> rivals;
+	std::stringstream list{options->compare};
+	std::string name;
+	while (std::getline(list, name, ',')) {
+		names.push_back(name);
+		rivals.push_back(getStrategy(&name, &options->rules));
+	}
+	if (rivals.empty() || (int) rivals.size() >= MAX_COMPARED) {
+		printf(Report::BAD_COMPARE, MAX_COMPARED - 1);
+		usage();
+	}
+
+	long long shoes = shoeCount(options), rounds = roundCount(options), played{0};
+	Runner runner{getVariant(&options->rules)->engine, getStrategy(&options->strategy, &options->rules), options->seats, options->seed, options->threads};
+	options->threads = runner.getNumThreads();
+
+	// Shoes are played in batches until the rounds asked for are reached
+	auto start = std::chrono::steady_clock::now();
+	Comparison comparison{(int) rivals.size() + 1, options->seats};
+	while (played < shoes && !(rounds > 0 && comparison.getRounds() >= rounds)) {
+		long long size = shoes - played;
+		if (rounds > 0) {
+			size = std::min(size, RunController::shoesForRounds(rounds, played, comparison.getRounds()));
+		}
+		comparison.merge(runner.runPaired(played, size, rivals.data(), (int) rivals.size()));
+		played += size;
+	}
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+	reportPaired(options, played, &names, &comparison, elapsed.count());
+}
+
+/*
+* Print the exact dealer final total probabilities for every upcard
+* from a full shoe and how fast a repeated query is answered
+*/
+void reportDealerOdds() {
+
+	DealerOdds odds{DEFAULT_DECK_SIZE};
+	const char* upcards[] = { "", "A", "2", "3", "4", "5", "6", "7", "8", "9", "10" };
+
+	printf(Report::ODDS_TITLE, DEFAULT_DECK_SIZE);
+	printf(Report::ODDS_HEADER);
+	for (int upcard = ACE; upcard <= TEN; upcard++) {
+
+		Composition shoe{DEFAULT_DECK_SIZE};
+		shoe.removeCard(upcard);
+		const DealerProbabilities& dealer = odds.getProbabilities(shoe, upcard);
+
+		printf(Report::ODDS_UPCARD, upcards[upcard]);
+		for (int i = 0; i < DEALER_TOTALS; i++) {
+			printf(Report::ODDS_CELL, dealer.total[i]);
+		}
+		printf(Report::ODDS_CELL, dealer.bust);
+		printf(Report::ODDS_NATURAL, dealer.natural);
+	}
+
+	Composition shoe{DEFAULT_DECK_SIZE};
+	shoe.removeCard(TEN);
+	const int queries{100000};
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < queries; i++) {
+		odds.getProbabilities(shoe, TEN);
+	}
+	std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+	printf(Report::ODDS_SPEED, odds.getCacheSize(), elapsed.count() / queries);
+}
+
+/*
+* Generate the basic strategy chart from the exact expected values
+* and write it out as the BasicStrategy.h header
+*/
+void writeBasicStrategy() {
+
+	StrategyChart chart{DEFAULT_DECK_SIZE};
+	chart.generate();
+	chart.write(std::cout);
+}
+
+#pragma endregion
+
+/*
+* Read the options,
+* resume the run from its checkpoint if asked,
+* play the shoes headlessly on every thread in batches,
+* reporting progress until the target precision or shoe limit,
+* report house edge and variance
+*/
+int main(int argc, char* argv[]) {
+
+	Options options{parseOptions(argc, argv)};
+	if (options.dealerOdds) {
+		reportDealerOdds();
+		return 0;
+	}
+	if (options.basicStrategy) {
+		writeBasicStrategy();
+		return 0;
+	}
+	if (options.sessions > 0) {
+		runSessions(&options);
+		return 0;
+	}
+	if (!options.compare.empty()) {
+		runPaired(&options);
+		return 0;
+	}
+	if (!options.resume.empty()) {
+		resumeOptions(&options);
+	}
+	long long shoes = shoeCount(&options);
+	Runner runner{getVariant(&options.rules)->engine, getStrategy(&options.strategy, &options.rules), options.seats, options.seed, options.threads};
+	options.threads = runner.getNumThreads();
+
+	RunController controller{&runner, options.precision / 100, shoes, roundCount(&options), &std::cerr};
+	if (!options.resume.empty() && !controller.resume(options.resume)) {
+		printf(Report::BAD_CHECKPOINT, options.resume.c_str());
+		return EXIT_FAILURE;
+	}
+	if (!options.checkpoint.empty()) {
+		controller.setCheckpoint(options.checkpoint, runSettings(&options, shoes));
+	}
+	auto start = std::chrono::steady_clock::now();
+	Results results{controller.run()};
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+	report(&options, &controller, &results, elapsed.count());
+	return 0;
+}
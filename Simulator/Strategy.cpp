@@ -0,0 +1,86 @@
+//---------------------------------Strategy.cpp---------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the implementation file for the Strategy classes used by
+//             the headless simulator. Strategy is the interface a simulated
+//             player implements to choose an action for its Hand given the
+//             dealer's upcard and the cards it has not seen. DealerStrategy
+//             mimics the dealer, NoBustStrategy never risks a BUST,
+//             OptimalStrategy takes the action with the highest exact expected
+//             value for the unseen cards, and BasicStrategy looks its action up
+//             in the generated chart.
+//------------------------------------------------------------------------------
+#include "Strategy.h"
+#include "Game.h"
+#include <tuple>
+
+//---------------------------------~Strategy------------------------------------
+//Description: Destructor for a Strategy.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+Strategy::~Strategy()
+{} // end of ~Strategy
+
+//-----------------------------------decide-------------------------------------
+//Description: Hits below 17 and stands otherwise, exactly like the dealer.
+//Parameters:  - hand: The Player's hand.
+//------------------------------------------------------------------------------
+Decision DealerStrategy::decide(const Hand &hand, int, bool, const Composition &) const
+{
+    return hand.getPoints() < DEALER_STAND ? Decision::HIT : Decision::STAND;
+} // end of decide
+
+//-----------------------------------decide-------------------------------------
+//Description: Hits only while no card can BUST the hand (hard 11 or less, or
+//             any soft hand below 17).
+//Parameters:  - hand: The Player's hand.
+//------------------------------------------------------------------------------
+Decision NoBustStrategy::decide(const Hand &hand, int, bool, const Composition &) const
+{
+    if (hand.isSoft())
+    {
+        return hand.getPoints() < DEALER_STAND ? Decision::HIT : Decision::STAND;
+    }
+    return hand.getPoints() <= BLACKJACK - TEN ? Decision::HIT : Decision::STAND;
+} // end of decide
+
+//------------------------------OptimalStrategy---------------------------------
+//Description: Constructor for OptimalStrategy.
+//Parameters:  - numDecks: Decks in a full shoe of the rules played.
+//------------------------------------------------------------------------------
+OptimalStrategy::OptimalStrategy(const int numDecks) : numDecks(numDecks)
+{} // end of OptimalStrategy
+
+//-----------------------------------decide-------------------------------------
+//Description: Takes the action with the highest exact expected value for the
+//             unseen cards. Each thread keeps its own ExpectedValue caches, one
+//             per deck count as their keys only fit shoes that size, so one
+//             OptimalStrategy can be shared by every Runner worker.
+//Parameters:  - hand:        The Player's hand.
+//             - upcard:      Rank of the dealer's visible card.
+//             - firstAction: Whether or not the Player has acted yet.
+//             - unseen:      Cards the Player has not seen.
+//------------------------------------------------------------------------------
+Decision OptimalStrategy::decide(const Hand &hand, int upcard, bool firstAction, const Composition &unseen) const
+{
+    static thread_local unordered_map<int, ExpectedValue> calculators;
+    auto calculator = calculators.find(this->numDecks);
+    if (calculator == calculators.end())
+    {
+        calculator = calculators.emplace(piecewise_construct, forward_as_tuple(this->numDecks),
+            forward_as_tuple(this->numDecks)).first;
+    }
+    return calculator->second.getValues(unseen, hand.getHardTotal(), hand.isSoft(), upcard, firstAction).best;
+} // end of decide
+
+//-----------------------------------decide-------------------------------------
+//Description: Looks the action up in the basic strategy chart; the unseen
+//             cards are not needed.
+//Parameters:  - hand:        The Player's hand.
+//             - upcard:      Rank of the dealer's visible card.
+//             - firstAction: Whether or not the Player has acted yet.
+//------------------------------------------------------------------------------
+Decision BasicStrategy::decide(const Hand &hand, int upcard, bool firstAction, const Composition &) const
+{
+    return basicDecision(hand.getPoints(), hand.isSoft(), upcard, firstAction);
+} // end of decide
@@ -0,0 +1,59 @@
+//---------------------------------Strategy.h-----------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the header file for the Strategy classes used by the
+//             headless simulator. Strategy is the interface a simulated player
+//             implements to choose an action for its Hand given the dealer's
+//             upcard and the cards it has not seen. DealerStrategy mimics the
+//             dealer, NoBustStrategy never risks a BUST, OptimalStrategy
+//             takes the action with the highest exact expected value for the
+//             unseen cards, and BasicStrategy looks its action up in the
+//             generated chart. New strategies derive from Strategy and are passed
+//             to a Simulation.
+//------------------------------------------------------------------------------
+#ifndef STRATEGY_H
+#define STRATEGY_H
+#include "Hand.h"
+#include "Composition.h"
+#include "ExpectedValue.h"
+#include "BasicStrategy.h"
+using namespace std;
+
+class Strategy
+{
+    public:
+        virtual ~Strategy();
+        //Decide an action for the hand. firstAction is true before the Player
+        //has hit, the only time a double down is allowed. unseen holds every
+        //card the Player has not seen, i.e. the shoe and the dealer's hole card.
+        virtual Decision decide(const Hand &hand, int upcard, bool firstAction, const Composition &unseen) const = 0;
+};
+
+class DealerStrategy : public Strategy
+{
+    public:
+        Decision decide(const Hand &hand, int upcard, bool firstAction, const Composition &unseen) const;
+};
+
+class NoBustStrategy : public Strategy
+{
+    public:
+        Decision decide(const Hand &hand, int upcard, bool firstAction, const Composition &unseen) const;
+};
+
+class OptimalStrategy : public Strategy
+{
+    private:
+        const int numDecks;     //Decks in a full shoe, which the caches are keyed for
+
+    public:
+        OptimalStrategy(const int numDecks);
+        Decision decide(const Hand &hand, int upcard, bool firstAction, const Composition &unseen) const;
+};
+
+class BasicStrategy : public Strategy
+{
+    public:
+        Decision decide(const Hand &hand, int upcard, bool firstAction, const Composition &unseen) const;
+};
+#endif
@@ -0,0 +1,201 @@
+//-----------------------------StrategyChart.cpp--------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the implementation file for the StrategyChart class. It
+//             builds the basic strategy chart for Game's rules offline from the
+//             exact expected values of every two card hand against every upcard
+//             and writes it out as the constexpr table in BasicStrategy.h.
+//------------------------------------------------------------------------------
+#include "StrategyChart.h"
+
+//Letter used for each Decision in the written table, in Decision order
+static const char DECISION_LETTERS[] = { 'S', 'H', 'R', 'D' };
+
+//-------------------------------StrategyChart----------------------------------
+//Description: Constructor for a StrategyChart. Every entry starts as STAND,
+//             which is what the totals no two card hand reaches (hard 21) use.
+//Parameters:  - numDecks: Number of decks in a full shoe.
+//------------------------------------------------------------------------------
+StrategyChart::StrategyChart(const int numDecks)
+{
+    this->numDecks = numDecks;
+    for (int soft = 0; soft < 2; soft++)
+    {
+        for (int first = 0; first < 2; first++)
+        {
+            for (int points = 0; points <= BLACKJACK; points++)
+            {
+                for (int upcard = 0; upcard <= NUM_RANKS; upcard++)
+                {
+                    this->chart[soft][first][points][upcard] = Decision::STAND;
+                }
+            }
+        }
+    }
+} // end of StrategyChart
+
+//--------------------------------getDecision-----------------------------------
+//Description: Returns the chart's action for a hand.
+//Parameters:  - points:      Player's total, counting a soft Ace as 11.
+//             - soft:        Whether or not an Ace in the hand counts as 11.
+//             - upcard:      Rank of the dealer's upcard.
+//             - firstAction: Whether or not the Player has acted yet.
+//------------------------------------------------------------------------------
+Decision StrategyChart::getDecision(int points, bool soft, int upcard, bool firstAction) const
+{
+    return this->chart[soft][firstAction][points][upcard];
+} // end of getDecision
+
+//----------------------------------generate------------------------------------
+//Description: Fills the chart. For every upcard, each two card hand's values
+//             are weighted by the chance of being dealt it from the shoe left
+//             after the upcard, and summed into its total. The after-hit chart
+//             uses the same hands with double down taken away.
+//Parameters:  N/A
+//------------------------------------------------------------------------------
+void StrategyChart::generate()
+{
+    ExpectedValue calculator(this->numDecks);
+    for (int upcard = ACE; upcard <= NUM_RANKS; upcard++)
+    {
+        ActionValues totals[2][BLACKJACK + 1] = {}; //[soft][points]
+        bool dealt[2][BLACKJACK + 1] = {};          //Whether or not a two card hand makes the total
+        Composition shoe(this->numDecks);
+        shoe.removeCard(upcard);
+        for (int first = ACE; first <= NUM_RANKS; first++)
+        {
+            double firstChance = shoe.getProbability(first);
+            shoe.removeCard(first);
+            for (int second = first; second <= NUM_RANKS; second++)
+            {
+                double chance = firstChance * shoe.getProbability(second) * (first == second ? 1 : 2);
+                shoe.removeCard(second);
+                int hardTotal = first + second;
+                bool soft = first == ACE;
+                int points = soft ? hardTotal + SOFT_BONUS : hardTotal;
+                addHand(totals[soft][points], calculator.getValues(shoe, hardTotal, soft, upcard, true), chance);
+                dealt[soft][points] = true;
+                shoe.addCard(second);
+            }
+            shoe.addCard(first);
+        }
+        for (int soft = 0; soft < 2; soft++)
+        {
+            for (int points = 0; points <= BLACKJACK; points++)
+            {
+                if (dealt[soft][points])
+                {
+                    this->chart[soft][true][points][upcard] = getBest(totals[soft][points], true);
+                    this->chart[soft][false][points][upcard] = getBest(totals[soft][points], false);
+                }
+            }
+        }
+        calculator.clearCache(); //Nothing is shared between upcards
+    }
+} // end of generate
+
+//-----------------------------------addHand------------------------------------
+//Description: Private function that adds a hand's values, weighted by its
+//             chance, to the running values of its total.
+//Parameters:  - total:  Running values of the total.
+//             - values: The hand's values.
+//             - chance: Chance of being dealt the hand.
+//------------------------------------------------------------------------------
+void StrategyChart::addHand(ActionValues &total, const ActionValues &values, double chance)
+{
+    total.stand += chance * values.stand;
+    total.hit += chance * values.hit;
+    total.doubleDown += chance * values.doubleDown;
+    total.surrender += chance * values.surrender;
+} // end of addHand
+
+//-----------------------------------getBest------------------------------------
+//Description: Private function that returns the action with the highest
+//             summed value. Ties keep the earlier action in Decision order.
+//Parameters:  - total:       Summed values of a total.
+//             - firstAction: Whether or not double down is allowed.
+//------------------------------------------------------------------------------
+Decision StrategyChart::getBest(const ActionValues &total, bool firstAction) const
+{
+    Decision best = Decision::STAND;
+    double bestValue = total.stand;
+    if (total.hit > bestValue)
+    {
+        best = Decision::HIT;
+        bestValue = total.hit;
+    }
+    if (total.surrender > bestValue)
+    {
+        best = Decision::SURRENDER;
+        bestValue = total.surrender;
+    }
+    if (firstAction && total.doubleDown > bestValue)
+    {
+        best = Decision::DOUBLE_DOWN;
+    }
+    return best;
+} // end of getBest
+
+//------------------------------------write-------------------------------------
+//Description: Writes the chart out as the BasicStrategy.h header.
+//Parameters:  - out: Stream to write the header to.
+//------------------------------------------------------------------------------
+void StrategyChart::write(ostream &out) const
+{
+    const char* softNames[] = { "Hard totals", "Soft totals" };
+    const char* firstNames[] = { "After a hit", "First action" };
+
+    out << "//-------------------------------BasicStrategy.h--------------------------------\n"
+        << "//Author: Johnathan Hewit\n"
+        << "//Team: LuckyNo13\n"
+        << "//Description: This is the basic strategy chart for Game's rules with "
+        << this->numDecks << " decks,\n"
+        << "//             generated by ./simulator --basic-strategy from the exact\n"
+        << "//             expected values of every two card hand. Do not edit it by\n"
+        << "//             hand. It is indexed [soft][firstAction][points][upcard], with\n"
+        << "//             a soft Ace counted in points, so a decision is one lookup.\n"
+        << "//             S stands, H hits, D doubles down and R surrenders.\n"
+        << "//------------------------------------------------------------------------------\n"
+        << "#ifndef BASICSTRATEGY_H\n"
+        << "#define BASICSTRATEGY_H\n"
+        << "#include \"Rules.h\"\n"
+        << "\n"
+        << "namespace Basic\n"
+        << "{\n"
+        << "    static constexpr Decision S = Decision::STAND, H = Decision::HIT,\n"
+        << "                              D = Decision::DOUBLE_DOWN, R = Decision::SURRENDER;\n"
+        << "\n"
+        << "    static constexpr Decision CHART[2][2][BLACKJACK + 1][NUM_RANKS + 1] =\n"
+        << "    {\n";
+    for (int soft = 0; soft < 2; soft++)
+    {
+        out << "        { //" << softNames[soft] << "\n";
+        for (int first = 0; first < 2; first++)
+        {
+            out << "            { //" << firstNames[first] << "\n"
+                << "                //     -  A  2  3  4  5  6  7  8  9  10\n";
+            for (int points = 0; points <= BLACKJACK; points++)
+            {
+                out << "                /*" << (points < 10 ? " " : "") << points << "*/ {";
+                for (int upcard = 0; upcard <= NUM_RANKS; upcard++)
+                {
+                    out << DECISION_LETTERS[(int) this->chart[soft][first][points][upcard]]
+                        << (upcard < NUM_RANKS ? ", " : "");
+                }
+                out << "}" << (points < BLACKJACK ? "," : "") << "\n";
+            }
+            out << "            }" << (first == 0 ? "," : "") << "\n";
+        }
+        out << "        }" << (soft == 0 ? "," : "") << "\n";
+    }
+    out << "    };\n"
+        << "}\n"
+        << "\n"
+        << "//Returns the basic strategy action for a hand: points counts a soft Ace as\n"
+        << "//11, and double down is only charted for the first action.\n"
+        << "constexpr Decision basicDecision(int points, bool soft, int upcard, bool firstAction)\n"
+        << "{\n"
+        << "    return Basic::CHART[soft][firstAction][points][upcard];\n"
+        << "}\n"
+        << "#endif\n";
+} // end of write
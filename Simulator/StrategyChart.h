@@ -0,0 +1,39 @@
+//------------------------------StrategyChart.h---------------------------------
+//Author: Johnathan Hewit
+//Team: LuckyNo13
+//Description: This is the header file for the StrategyChart class. It builds
+//             the basic strategy chart for Game's rules offline: for every
+//             upcard and every two card hand it asks ExpectedValue for the
+//             exact value of each action from a full shoe, averages the values
+//             of the hands that share a total weighted by how likely each hand
+//             is, and keeps the best action for each hard and soft total, both
+//             as the first action and after a hit. The chart is written out as
+//             the constexpr table in BasicStrategy.h, so a decision at the table
+//             costs a single array index.
+//------------------------------------------------------------------------------
+#ifndef STRATEGYCHART_H
+#define STRATEGYCHART_H
+#include <ostream>
+#include "Rules.h"
+#include "Composition.h"
+#include "ExpectedValue.h"
+using namespace std;
+
+class StrategyChart
+{
+    private:
+        int numDecks;                                                   //Number of decks in a full shoe
+        Decision chart[2][2][BLACKJACK + 1][NUM_RANKS + 1];             //[soft][firstAction][points][upcard]
+        void addHand(ActionValues &total, const ActionValues &values, double chance);
+        Decision getBest(const ActionValues &total, bool firstAction) const;
+
+    public:
+        //Constructors
+        StrategyChart(const int numDecks);
+        //Getters
+        Decision getDecision(int points, bool soft, int upcard, bool firstAction) const;
+        void write(ostream &out) const;
+        //Setters
+        void generate();
+};
+#endif
@@ -0,0 +1,2 @@
+#!/usr/bin/env bash
+g++ -std=c++14 -O2 -pthread -Wall -Wextra -w -I../Server *.cpp ../Server/Random.cpp ../Server/Composition.cpp ../Server/DealerOdds.cpp ../Server/ExpectedValue.cpp ../Server/CardCounter.cpp -o simulator
@@ -36,30 +36,34 @@ int main ()
     for (turn = 0; turn < players.size(); turn++)
     {
       input = "";
-      while (!(input == "stand" || input == "surrender" || input == "doubledown" || input == "quit")) // Turns
+      canHit = true;
+      while (canHit && input != "quit") // Turns, until every split hand is played
       {
-        cout << "It's " << players[turn] << "'s turn!\n\nType 'hit', 'stand', 'surrender' or 'doubledown'\n" << endl; 
+        cout << "It's " << players[turn] << "'s turn!\n\nType 'hit', 'stand', 'surrender', 'doubledown' or 'split'\n" << endl; 
         cin >> input;
         if (input == "hit")
         {
           canHit = newGame->hit(players[turn]);
           cout << newGame->displayCards();
-          if (canHit == false)
-          {
-            break;
-          }
+        }
+        if (input == "stand")
+        {
+          canHit = newGame->stand(players[turn]);
         }
         if (input == "surrender")
         {
-          newGame->surrender(players[turn]);
+          canHit = newGame->surrender(players[turn]);
           cout << newGame->displayCards();
-          break;
         }
         if (input == "doubledown")
         {
-          newGame->doubleDown(players[turn]);
+          canHit = newGame->doubleDown(players[turn]);
+          cout << newGame->displayCards();
+        }
+        if (input == "split")
+        {
+          canHit = newGame->split(players[turn]);
           cout << newGame->displayCards();
-          break;
         }
       }
     }